@@ -0,0 +1,39 @@
+# Host (x86/ARM desktop) build of the robot code against the simulated PROS device layer in sim/.
+# `make host` builds every program in sim/programs into bin/host with the native compiler, so control
+# code can be run and timed on a laptop without a V5 brain. src/main.cpp is left out because it
+# constructs the robot as a global; programs build their own inside a sim::World.
+
+HOST_CXX?=g++
+HOST_CXXFLAGS?=-O2 -g
+HOST_BINDIR=$(BINDIR)/host
+HOST_OBJDIR=$(HOST_BINDIR)/obj
+SIMDIR=$(ROOT)/sim
+
+HOST_INCLUDE=-I$(INCDIR) -iquote"$(INCDIR)/okapi/squiggles" -I$(SIMDIR)/include
+# pros/screen.h defines _GNU_SOURCE itself, which g++ already predefines on glibc hosts
+HOST_FLAGS=--std=gnu++17 -U_GNU_SOURCE -Wno-psabi -Wno-deprecated-declarations $(HOST_CXXFLAGS) $(EXTRA_HOST_CXXFLAGS)
+
+HOST_SRC=$(filter-out $(SRCDIR)/main.cpp,$(call rwildcard,$(SRCDIR),*.cpp)) $(call rwildcard,$(SIMDIR)/src,*.cpp)
+HOST_OBJ=$(patsubst $(ROOT)/%.cpp,$(HOST_OBJDIR)/%.o,$(HOST_SRC))
+HOST_PROGRAMS=$(patsubst $(SIMDIR)/programs/%.cpp,$(HOST_BINDIR)/%,$(wildcard $(SIMDIR)/programs/*.cpp))
+
+.PHONY: host
+host: $(HOST_PROGRAMS)
+
+$(HOST_BINDIR)/%: $(HOST_OBJDIR)/sim/programs/%.o $(HOST_OBJ)
+	$(call test_output_2,Linking $@ ,$(HOST_CXX) $(HOST_FLAGS) -o $@ $^ -lpthread,$(OK_STRING))
+
+# Sources in src/ also see their own include directory quoted, like the firmware build does
+$(HOST_OBJDIR)/src/%.o: $(SRCDIR)/%.cpp
+	$(VV)mkdir -p $(dir $@)
+	$(call test_output_2,Compiled $< for host ,$(HOST_CXX) -c $(HOST_INCLUDE) -iquote"$(INCDIR)/$(dir $*)" $(HOST_FLAGS) -MMD -MP -o $@ $<,$(OK_STRING))
+
+$(HOST_OBJDIR)/sim/%.o: $(SIMDIR)/%.cpp
+	$(VV)mkdir -p $(dir $@)
+	$(call test_output_2,Compiled $< for host ,$(HOST_CXX) -c $(HOST_INCLUDE) $(HOST_FLAGS) -MMD -MP -o $@ $<,$(OK_STRING))
+
+# Objects only reached through the pattern rules count as intermediate, and make would delete them after linking
+.PRECIOUS: $(HOST_OBJDIR)/sim/programs/%.o
+.SECONDARY: $(HOST_OBJ)
+
+-include $(shell find $(HOST_OBJDIR) -name '*.d' 2>/dev/null)
@@ -0,0 +1,27 @@
+# Route trajectories are generated on the host from include/PathFollowing/RouteSpecs.h into constant tables in
+# src/PathFollowing/RouteTables.cpp, so the robot does no trajectory generation at runtime. The tables are checked
+# in, so the firmware still builds without a host compiler; with one, `make` regenerates them whenever the specs
+# or the generator change, before compiling them.
+
+HOST_CXX?=g++
+ROUTE_SPECS=$(INCDIR)/PathFollowing/RouteSpecs.h
+ROUTE_TABLES=$(SRCDIR)/PathFollowing/RouteTables.cpp
+ROUTE_GENERATOR=$(BINDIR)/host/GenerateRoutes
+# Only what the generator uses, not the rest of src/, which includes the tables it writes
+ROUTE_GENERATOR_SRC=$(ROOT)/sim/programs/GenerateRoutes.cpp $(SRCDIR)/PathFollowing/RouteGenerator.cpp \
+    $(SRCDIR)/PathFollowing/IndexedPath.cpp
+ROUTE_GENERATOR_HEADERS=$(INCDIR)/PathFollowing/Routes.h $(INCDIR)/PathFollowing/RouteGenerator.h \
+    $(INCDIR)/PathFollowing/IndexedPath.h
+
+ifneq ($(shell command -v $(HOST_CXX) 2>/dev/null),)
+
+# The tables are out of date when the specs or the generator's sources change, not when a clean build relinks the
+# generator, so the generator binary is only an order-only prerequisite
+$(ROUTE_TABLES): $(ROUTE_SPECS) $(ROUTE_GENERATOR_SRC) $(ROUTE_GENERATOR_HEADERS) | $(ROUTE_GENERATOR)
+	$(call test_output_2,Generating $@ ,$(ROUTE_GENERATOR) $@ > /dev/null,$(OK_STRING))
+
+$(ROUTE_GENERATOR): $(ROUTE_GENERATOR_SRC) $(ROUTE_SPECS) $(ROUTE_GENERATOR_HEADERS)
+	$(VV)mkdir -p $(dir $@)
+	$(call test_output_2,Linking $@ ,$(HOST_CXX) $(HOST_INCLUDE) $(HOST_FLAGS) -o $@ $(ROUTE_GENERATOR_SRC),$(OK_STRING))
+
+endif
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <math.h>
+
+/*
+Fixed-size matrix of doubles, stored inline so that filters can do their linear algebra on the stack without any
+heap allocation. Sizes are template parameters, so mismatched products fail to compile.
+*/
+template <int ROWS, int COLS>
+class Matrix {
+
+public:
+
+    double m[ROWS][COLS] = {};
+
+    double& operator()(int r, int c) { return m[r][c]; }
+    double operator()(int r, int c) const { return m[r][c]; }
+
+    static Matrix identity() {
+        static_assert(ROWS == COLS, "identity matrix must be square");
+        Matrix out;
+        for (int i = 0; i < ROWS; i++) out.m[i][i] = 1;
+        return out;
+    }
+
+    Matrix<COLS, ROWS> transpose() const {
+        Matrix<COLS, ROWS> out;
+        for (int r = 0; r < ROWS; r++) {
+            for (int c = 0; c < COLS; c++) out.m[c][r] = m[r][c];
+        }
+        return out;
+    }
+
+    Matrix operator+(const Matrix& other) const {
+        Matrix out;
+        for (int r = 0; r < ROWS; r++) {
+            for (int c = 0; c < COLS; c++) out.m[r][c] = m[r][c] + other.m[r][c];
+        }
+        return out;
+    }
+
+    Matrix operator-(const Matrix& other) const {
+        Matrix out;
+        for (int r = 0; r < ROWS; r++) {
+            for (int c = 0; c < COLS; c++) out.m[r][c] = m[r][c] - other.m[r][c];
+        }
+        return out;
+    }
+
+    template <int K>
+    Matrix<ROWS, K> operator*(const Matrix<COLS, K>& other) const {
+        Matrix<ROWS, K> out;
+        for (int r = 0; r < ROWS; r++) {
+            for (int i = 0; i < COLS; i++) {
+                if (m[r][i] == 0) continue; // Jacobians are mostly zeros
+                for (int c = 0; c < K; c++) out.m[r][c] += m[r][i] * other.m[i][c];
+            }
+        }
+        return out;
+    }
+
+    Matrix operator*(double scale) const {
+        Matrix out;
+        for (int r = 0; r < ROWS; r++) {
+            for (int c = 0; c < COLS; c++) out.m[r][c] = m[r][c] * scale;
+        }
+        return out;
+    }
+};
+
+// Gauss-Jordan elimination with partial pivoting. Returns false if the matrix is singular
+template <int N>
+bool invert(const Matrix<N, N>& matrix, Matrix<N, N>& inverse) {
+
+    Matrix<N, N> a = matrix;
+    inverse = Matrix<N, N>::identity();
+
+    for (int col = 0; col < N; col++) {
+
+        int pivot = col;
+        for (int r = col + 1; r < N; r++) {
+            if (fabs(a.m[r][col]) > fabs(a.m[pivot][col])) pivot = r;
+        }
+        if (a.m[pivot][col] == 0) return false;
+
+        if (pivot != col) {
+            for (int c = 0; c < N; c++) {
+                double t = a.m[col][c]; a.m[col][c] = a.m[pivot][c]; a.m[pivot][c] = t;
+                t = inverse.m[col][c]; inverse.m[col][c] = inverse.m[pivot][c]; inverse.m[pivot][c] = t;
+            }
+        }
+
+        double scale = 1 / a.m[col][col];
+        for (int c = 0; c < N; c++) {
+            a.m[col][c] *= scale;
+            inverse.m[col][c] *= scale;
+        }
+
+        for (int r = 0; r < N; r++) {
+            if (r == col || a.m[r][col] == 0) continue;
+            double factor = a.m[r][col];
+            for (int c = 0; c < N; c++) {
+                a.m[r][c] -= factor * a.m[col][c];
+                inverse.m[r][c] -= factor * inverse.m[col][c];
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/*
+Fixed-capacity ring buffer for exactly one producer task and one consumer task. push() and pop() are constant
+time, never allocate and never block: the producer only writes head and the consumer only writes tail, so no lock
+is needed. A push onto a full ring is dropped and counted rather than waiting for the consumer.
+
+CAPACITY must be a power of two. One slot is always left empty to tell full from empty.
+*/
+template <typename T, uint32_t CAPACITY>
+class SPSCRing {
+
+    static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0, "SPSCRing capacity must be a power of two");
+
+public:
+
+    // Producer side
+    bool push(const T& item) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        uint32_t next = (h + 1) & MASK;
+        if (next == tail.load(std::memory_order_acquire)) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        items[h] = item;
+        head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side
+    bool pop(T& item) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) return false;
+        item = items[t];
+        tail.store((t + 1) & MASK, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. The front item without removing it
+    const T* peek() const {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) return nullptr;
+        return &items[t];
+    }
+
+    // Approximate from either side, since the other side may be moving
+    uint32_t size() const {
+        return (head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire)) & MASK;
+    }
+
+    uint32_t getDropped() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+
+    static constexpr uint32_t MASK = CAPACITY - 1;
+
+    T items[CAPACITY];
+    std::atomic<uint32_t> head{0}; // next slot to write
+    std::atomic<uint32_t> tail{0}; // next slot to read
+    std::atomic<uint32_t> dropped{0};
+};
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/*
+Publishes a value from one writer task to any number of reader tasks without a lock, so readers always get a
+complete value and never one that is half updated. The writer fills whichever of the two buffers readers aren't
+using and then flips to it; a reader copies the published buffer and checks the writer didn't start reusing that
+buffer meanwhile, retrying if it did.
+
+A reader that preempts the writer mid-write reads the previous value without retrying, so a high priority reader
+never spins waiting on a lower priority writer. Writers must be serialized by the caller.
+*/
+template <typename T>
+class SeqlockBuffer {
+
+public:
+
+    void write(const T& value) {
+        uint32_t next = published.load(std::memory_order_relaxed) + 1;
+        writing.store(next, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        buffers[next & 1] = value;
+        published.store(next, std::memory_order_release);
+    }
+
+    T read() const {
+        while (true) {
+            uint32_t index = published.load(std::memory_order_acquire);
+            T value = buffers[index & 1];
+            std::atomic_thread_fence(std::memory_order_acquire);
+            // Writes up to index + 1 only touch the other buffer
+            if (writing.load(std::memory_order_relaxed) - index <= 1) return value;
+        }
+    }
+
+    uint32_t getWrites() const { return published.load(std::memory_order_acquire); }
+
+private:
+
+    T buffers[2] = {};
+    std::atomic<uint32_t> published{0}; // writes completed; buffers[published & 1] is current
+    std::atomic<uint32_t> writing{0}; // write in progress or last completed
+};
@@ -2,6 +2,7 @@
 #include "main.h"
 #include "Subsystems/Robot.h"
 #include "misc/ProsUtility.h"
+#include "misc/Telemetry.h"
 
 // First shot intake speed = -1, otherwise intake speed = -0.5
 class Shooter {
@@ -29,9 +30,10 @@ public:
 
     double tickIntakeShootingSpeed(Robot& robot) {
 
-        double diff = robot.flywheel->getTargetVelocity() - robot.flywheel->getCurrentVelocity();
-        printf("%d, %f, %f, %f, %f, %f \n", state, diff, robot.flywheel->getTargetVelocity(), robot.flywheel->getCurrentVelocity(),
-        robot.flywheel->motors.get_actual_velocities()[0], robot.flywheel->motors.get_actual_velocities()[1]);
+        FlywheelSample velocity = robot.flywheel->getVelocitySample();
+        double diff = robot.flywheel->getTargetVelocity() - velocity.rpm;
+        telemetry.log(TELEMETRY_SHOOTER, {(float) state, (float) diff, (float) robot.flywheel->getTargetVelocity(),
+            (float) velocity.rpm, (float) velocity.motorVelocity[0], (float) velocity.motorVelocity[1]});
 
         if (state == 0 && diff > 175) { // flywheel slowed down. Means we just finished shooting a disc
             discNum++;
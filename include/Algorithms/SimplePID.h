@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 typedef struct PIDParameters {
   double P, I, D;
   double MIN, MAX;
@@ -19,6 +21,9 @@ typedef struct PIDParameters {
 
 /*
 A PID controller with configurable parameters. Does not have termination logic
+
+The I and D terms use the measured time between ticks, so gains are per second and stay valid if the calling
+loop changes rate. The derivative can optionally be low-pass filtered to calm down sensor noise.
 */
 class SimplePID {
 
@@ -28,12 +33,23 @@ public:
   virtual double tick(double error);
   void setNewParam(double kp, double ki, double kd);
   double getCurrentError();
+
+  // First-order low pass on the derivative term with the given time constant in seconds. 0 disables it
+  void setDerivativeFilter(double timeConstant);
+  double getLastDt();
+
 protected:
   virtual void handleEndCondition(double error) {}
 
   double prevError = 0;
   double prevIntegral = 0;
   double prevOutput = 0;
+  double prevDerivative = 0;
+
+  bool ticked = false;
+  uint64_t prevTime = 0; // micros() of the previous tick
+  double lastDt = 0;
+  double derivativeTimeConstant = 0;
   
   PIDParameters K;
   bool limitAccel;
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+
+/*
+Fixed-capacity history of timestamped items, oldest first, that overwrites the oldest item when full. Items must be
+pushed in time order and have a uint64_t time member, which find() binary searches in O(log n). Not synchronized:
+the caller serializes access.
+*/
+template <typename T, uint32_t CAPACITY>
+class TimedRing {
+
+public:
+
+    void push(const T& item) {
+        items[(start + count) % CAPACITY] = item;
+        if (count < CAPACITY) count++;
+        else start = (start + 1) % CAPACITY;
+    }
+
+    void clear() { start = count = 0; }
+
+    uint32_t size() const { return count; }
+
+    // 0 is the oldest item, size() - 1 the newest
+    T& operator[](uint32_t i) { return items[(start + i) % CAPACITY]; }
+    const T& operator[](uint32_t i) const { return items[(start + i) % CAPACITY]; }
+
+    const T& back() const { return (*this)[count - 1]; }
+
+    // Index of the newest item at or before time, -1 if there is none
+    int find(uint64_t time) const {
+        int low = 0, high = count; // answer is in [low - 1, high - 1]
+        while (low < high) {
+            int mid = (low + high) / 2;
+            if ((*this)[mid].time <= time) low = mid + 1;
+            else high = mid;
+        }
+        return low - 1;
+    }
+
+private:
+
+    T items[CAPACITY];
+    uint32_t start = 0, count = 0;
+};
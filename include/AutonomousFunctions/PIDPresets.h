@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Algorithms/SimplePID.h"
+#include "Algorithms/DoubleBoundedPID.h"
+#include "Algorithms/NoPID.h"
+#include "misc/MathUtility.h"
+
+// PID presets used by the autonomous routes. Kept in a header so tuning tools can run the exact same controllers
+// I and D gains are per second of measured loop time. They were tuned when SimplePID assumed a 20 ms tick while
+// the loops ran every 10 ms, so they were converted with I x2 and D /2 to keep the same behavior
+
+// for cata momentum
+#define GFU_DIST_FAST(maxSpeed) DoubleBoundedPID({0.17, 0, 0.0085, 0.12, maxSpeed}, 0.075, 3, false)
+
+// for normal forwards
+#define GFU_DIST_PRECISE(maxSpeed) DoubleBoundedPID({0.123, 0, 0.0135, 0.12, clamp(maxSpeed,-0.8,0.8), 0.03}, 0.075, 3)
+
+
+#define GFU_TURN SimplePID({1, 3, 0, 0.0, 1})
+#define GTU_TURN DoubleBoundedPID({1.25, 0.00, 0.0475, 0.15, 1}, getRadians(1.5), 1)
+
+#define GTU_TURN_PRECISE DoubleBoundedPID({1.25, 0.01, 0.065, 0.17, 1}, getRadians(0.5), 3)
+
+#define GCU_CURVE SimplePID({2.5/*2.25*//*1.7*/, 0, 0})
+
+#define NO_CORRECTION SimplePID({0,0,0})
+
+// don't stop motors at end
+#define NO_SLOWDOWN(maxSpeed) NoPID(maxSpeed)
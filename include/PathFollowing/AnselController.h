@@ -1,13 +1,15 @@
 #pragma once
 #include "Controller.h"
+#include "IndexedPath.h"
 
 class AnselController : public Controller {
 
 public:
-    void runSegment(std::vector<Waypoint>& path) override;
-
-private:
-    Waypoint getTargetWaypoint(std::vector<Waypoint>& path, int& closestIndex, Waypoint& currentPosition);
+    // Steer away from the target like the original law did (left faster for a target on the left), which never
+    // reaches it. Only for comparing against it in the sim
+    bool invertedSteering = false;
 
+    void runSegment(std::vector<Waypoint>& path) override;
+    void runSegment(const IndexedPath& path) override;
 
-};
\ No newline at end of file
+};
@@ -2,6 +2,7 @@
 #include <vector>
 #include "Subsystems/Robot.h"
 #include "Waypoint.h"
+#include "IndexedPath.h"
 
 class Controller {
 
@@ -10,4 +11,5 @@ protected:
 public:
     void initRobot(Robot* robotP) {robot = robotP; }
     virtual void runSegment(std::vector<Waypoint>& path) = 0;
+    virtual void runSegment(const IndexedPath& path) = 0;
 };
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <vector>
+#include "Waypoint.h"
+
+// A waypoint of an IndexedPath, with the segment from it to the next waypoint
+typedef struct PathPoint {
+    double x, y;
+    double s; // arc length from the start of the path, inches
+    double tangentX, tangentY; // unit direction of the segment. The last point repeats the last segment's
+    double length; // of the segment, 0 for the last point
+    double curvature; // 1/inches, CCW positive, through this point and its neighbors. 0 at the ends
+} PathPoint;
+
+// Closest point of a path to a position
+typedef struct PathProjection {
+    int segment; // index of the segment's first point
+    double s; // arc length of the closest point
+    double x, y;
+    double crossTrack; // distance from the path, positive when the position is left of it
+} PathProjection;
+
+/*
+A path of waypoints indexed by arc length, so a follower can ask for a point a distance ahead instead of a number of
+waypoints ahead, whatever the waypoint spacing. Arc length, tangents and curvature are computed once up front.
+
+Lookups take a hint, the segment of the previous lookup, and only walk forward from it. A robot moves a bounded
+distance per control tick, so a tick costs the same on a long skills path as on a short one.
+
+A path built from waypoints owns its points. One built from a PathPoint table, like the routes generated at build
+time (see Routes.h), only refers to it and allocates nothing.
+*/
+class IndexedPath {
+
+public:
+
+    static constexpr double PROJECTION_WINDOW = 24; // inches past the hint's segment the projection looks
+
+    IndexedPath() = default;
+    IndexedPath(const std::vector<Waypoint>& waypoints); // repeated waypoints are dropped
+    IndexedPath(const float* x, const float* y, int count); // the same from separate arrays, e.g. a PathFile segment
+    IndexedPath(const PathPoint* points, int count); // table must outlive the path
+    IndexedPath(const IndexedPath& other);
+    IndexedPath& operator=(const IndexedPath& other);
+    IndexedPath(IndexedPath&& other) = default;
+    IndexedPath& operator=(IndexedPath&& other) = default;
+
+    int size() const { return count; }
+    double getLength() const { return count == 0 ? 0 : points[count - 1].s; }
+    const PathPoint& operator[](int i) const { return points[i]; }
+
+    // Closest point on the segments from hint to PROJECTION_WINDOW further along, so the path crossing itself or
+    // coming back near an earlier part can't make the projection jump
+    PathProjection project(double x, double y, int hint = 0) const;
+
+    // Segment containing arc length s, walking forward from hint
+    int segmentAt(double s, int hint = 0) const;
+    Waypoint pointAt(double s, int hint = 0) const;
+    double curvatureAt(double s, int hint = 0) const; // interpolated between the segment's ends
+
+private:
+
+    std::vector<PathPoint> owned; // empty when viewing a table
+    const PathPoint* points = nullptr;
+    int count = 0;
+
+    void add(double x, double y); // to owned, unless it repeats the last point
+    void index(); // fill in owned's arc length, tangents and curvature and point points at it
+};
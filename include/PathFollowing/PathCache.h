@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Routes.h"
+#include "RouteSpecs.h"
+#include "pros/rtos.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/*
+Makes every route in RouteSpecs.h ready to follow without autonomous ever waiting on spline math. start() hands the
+routes to a low priority task, meant to run during initialize() and competition_initialize(). For each route the
+task uses the build-time table if it was generated from the same spec, else loads the copy an earlier boot saved to
+the SD card, and only generates the route when neither matches, then saves it to the card for the next boot.
+
+Routes are keyed by the hash of their spec (see getRouteHash()), so an edited route is never served stale. Routes
+served from their tables take no memory here. Only a route loaded or generated gets a buffer, sized to it, while the
+cache runs, so following one allocates nothing.
+
+getPath() never blocks: a route still being made is simply not ready yet.
+*/
+class PathCache {
+
+public:
+
+    static constexpr int MAX_ROUTES = 8;
+    static constexpr int MAX_POINTS = 4096; // in a saved route, so a corrupt file can't ask for a huge buffer
+
+    // Start the cache task if it isn't already running. specs must outlive the cache. Saved routes are files
+    // sdPrefix<hash>.bin
+    void start(const RouteSpec* specs = ROUTE_SPECS, int count = ROUTE_SPEC_COUNT,
+        const char* sdPrefix = "/usd/route_", uint32_t taskPriority = TASK_PRIORITY_MIN);
+
+    // Make every route ready now, in the calling task. Run by the cache task
+    void fill();
+
+    // False if there is no route with that name or it isn't ready yet
+    bool getPath(const char* name, IndexedPath& path);
+    bool isDone() { return done; }
+
+    // Where the ready routes came from
+    uint32_t getFromTables() { return fromTables; }
+    uint32_t getFromSd() { return fromSd; }
+    uint32_t getGenerated() { return generated; }
+
+private:
+
+    typedef struct Entry {
+        const RouteSpec* spec;
+        uint32_t hash;
+        std::atomic<bool> ready{false};
+        const PathPoint* points = nullptr;
+        int count = 0;
+        std::vector<PathPoint> storage; // empty when points is the build-time table. Only touched by fill()
+    } Entry;
+
+    Entry entries[MAX_ROUTES];
+    int entryCount = 0;
+    char prefix[32] = "";
+    std::atomic<bool> done{false};
+    uint32_t fromTables = 0, fromSd = 0, generated = 0;
+
+    std::unique_ptr<pros::Task> task;
+
+    bool useTable(Entry& entry);
+    bool load(Entry& entry);
+    bool generate(Entry& entry);
+    void save(const Entry& entry);
+};
+
+extern PathCache pathCache;
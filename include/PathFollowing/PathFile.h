@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/*
+Binary path file, read from the SD card in one bulk read and used in place with no per-point parsing. Everything is
+little endian (both the V5 and desktops are) and 4-byte aligned, so the arrays are read straight out of the buffer:
+
+    header:         PathFileHeader
+    segment table:  PathFileSegment per segment
+    arrays:         float x[points], y[points]
+
+A segment is a run of points one PathFollower::runSegment() call follows, in inches. Only positions are stored:
+IndexedPath works out arc length, tangents and curvature from them when a segment is indexed. sim/programs/ConvertPath
+writes these from PathGen or squiggles CSV.
+*/
+
+constexpr uint32_t PATH_FILE_MAGIC = 0x48544150; // "PATH"
+constexpr uint16_t PATH_FILE_VERSION = 2;
+constexpr int PATH_FILE_ARRAYS = 2;
+
+typedef struct PathFileHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t segmentCount;
+    uint32_t pointCount;
+    uint32_t size; // bytes in the whole file, to catch a truncated copy
+} PathFileHeader;
+
+typedef struct PathFileSegment {
+    uint32_t first; // index of the segment's first point
+    uint32_t count;
+} PathFileSegment;
+
+// One point, for writing a file. Reading goes through the arrays
+typedef struct PathFilePoint {
+    float x, y;
+} PathFilePoint;
+
+// A segment's slice of each array
+typedef struct PathSegmentView {
+    uint32_t count;
+    const float *x, *y;
+} PathSegmentView;
+
+class PathFile {
+
+public:
+
+    // Read and check a whole file. On failure the file is left empty
+    bool load(const char* path);
+    // Take ownership of a file's bytes already in memory
+    bool load(std::unique_ptr<uint8_t[]> bytes, uint32_t byteCount);
+
+    static std::vector<uint8_t> encode(const std::vector<std::vector<PathFilePoint>>& segments);
+
+    int getSegmentCount() const { return header ? header->segmentCount : 0; }
+    uint32_t getPointCount() const { return header ? header->pointCount : 0; }
+    PathSegmentView getSegment(int index) const;
+
+private:
+
+    std::unique_ptr<uint8_t[]> data;
+    const PathFileHeader* header = nullptr;
+    const PathFileSegment* segments = nullptr;
+    const float* arrays[PATH_FILE_ARRAYS] = {};
+
+    void clear();
+};
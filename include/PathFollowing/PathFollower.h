@@ -3,13 +3,15 @@
 #include <vector>
 #include <memory>
 #include "Controller.h"
+#include "PathFile.h"
+#include "PathCache.h"
 #include "Subsystems/Robot.h"
 
 class PathFollower {
 
 private:
 
-    std::vector<std::vector<Waypoint>> path;
+    std::vector<IndexedPath> path; // one per segment, indexed once when loaded
     std::unique_ptr<Controller> controller;
     Robot& robot;
 
@@ -21,8 +23,17 @@ public:
     {
         controller->initRobot(&robot);
 
-    } // generate path from reading from file
+    }
+
+    // Read and index the path's segments from a file written by sim/programs/ConvertPath. Call in initialize(): it
+    // is one bulk read, so routes can change on the SD card without recompiling. Keeps the old path if the file is bad
+    bool loadPath(const char* sdPath = "/usd/path.bin");
+    int getSegmentCount() { return path.size(); }
 
     void runSegment(int index);
+    // Blocking. Follows a route from pathCache, or its build-time table if the cache hasn't got to it yet and the
+    // table is current with RouteSpecs.h. False, driving nothing, if there is no route by that name or the only copy
+    // ready is stale
+    bool runRoute(const char* name);
 
-};
\ No newline at end of file
+};
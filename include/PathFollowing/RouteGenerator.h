@@ -0,0 +1,15 @@
+#pragma once
+
+#include <vector>
+#include "RouteSpecs.h"
+#include "Routes.h"
+
+constexpr double ROUTE_SPACING = 1; // inches between generated points
+constexpr uint32_t ROUTE_GENERATOR_VERSION = 2; // change when generation changes, so saved routes are regenerated
+
+// Hash of everything a route's generation depends on, to tell whether a generated route is still current
+uint32_t getRouteHash(const RouteSpec& spec);
+
+// The quintic Hermite splines through the spec's poses, resampled every ROUTE_SPACING inches of arc length. False if
+// the spec is invalid
+bool generateRoute(const RouteSpec& spec, std::vector<PathPoint>& points);
@@ -0,0 +1,34 @@
+#pragma once
+
+/*
+The named autonomous routes, as the poses a route passes through. The build runs sim/programs/GenerateRoutes on
+these to write src/PathFollowing/RouteTables.cpp (see firmware/routes.mk), and the robot uses the generated tables
+through Routes.h. If a table is out of date with its spec, PathCache generates the route on the robot instead. Edit
+routes here, never the tables.
+
+Poses are inches and degrees, heading CCW from +x like Odometry. Consecutive poses are joined by quintic Hermite
+splines like squiggles' SplineGenerator makes.
+*/
+
+typedef struct RoutePose {
+    double x, y, heading;
+} RoutePose;
+
+typedef struct RouteSpec {
+    static constexpr int MAX_POSES = 8;
+
+    const char* name;
+    int poseCount;
+    RoutePose poses[MAX_POSES];
+} RouteSpec;
+
+// The goCurveU() arcs of the autonomous programs in src/Programs. Poses are in field coordinates, dead reckoned from
+// the program's starting position through its drives and turns
+constexpr RouteSpec ROUTE_SPECS[] = {
+    // ThreeTileAuton, after the third shot: an 84.33 in radius arc from 339.34 to 7.02 degrees
+    {"threeTileCurve", 2, {{21.47, 61.87, 339.34}, {61.53, 57.08, 7.02}}},
+    // TwoTileAuton, before the third shot: arcs of 8.59 in and 10.45 in radius, out to 301.19 degrees and back
+    {"twoTileS", 3, {{78.33, 59.24, 242.92}, {78.63, 50.88, 301.19}, {78.95, 40.62, 242.32}}},
+};
+
+constexpr int ROUTE_SPEC_COUNT = sizeof(ROUTE_SPECS) / sizeof(ROUTE_SPECS[0]);
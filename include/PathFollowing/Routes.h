@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include "IndexedPath.h"
+
+/*
+A route generated at build time from RouteSpecs.h into constant tables linked into the binary, so following one
+does no generation and allocates nothing: getPath() only refers to the table.
+*/
+typedef struct Route {
+    const char* name;
+    const PathPoint* points;
+    int count;
+    uint32_t hash; // of the RouteSpec it was generated from, see getRouteHash()
+} Route;
+
+extern const Route ROUTES[];
+extern const int ROUTE_COUNT;
+
+// nullptr if there is no route with that name
+const Route* getRoute(const char* name);
+inline IndexedPath getPath(const Route& route) { return IndexedPath(route.points, route.count); }
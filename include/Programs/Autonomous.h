@@ -8,4 +8,8 @@ void twoTileSkills(Robot& robot);
 
 void testAuton(Robot& robot);
 
+void setShootDistance(Robot& robot, double rpm, bool flapUp);
+void shoot(Robot& robot, int diskNum);
+
+void shootCata(Robot& robot);
 void shootCataNonblocking(Robot& robot);
\ No newline at end of file
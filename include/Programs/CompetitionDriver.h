@@ -4,6 +4,7 @@
 #include "pros/misc.h"
 #include "Algorithms/Shooter.h"
 #include "Algorithms/FixedRingQueue.h"
+#include "misc/PeriodicLoop.h"
 
 enum DRIVE_TYPE {TANK_DRIVE, ARCADE_DRIVE};
 
@@ -17,9 +18,13 @@ public:
     {}
 
     void runDriver() override;
+
+    const LoopTiming& getLoopTiming() { return loopTiming; }
         
 private:
 
+    LoopTiming loopTiming;
+
     void handleDrivetrain();
     virtual void initDriver() {}
     virtual void handleSecondaryActions() {}
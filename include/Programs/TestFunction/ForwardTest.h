@@ -4,7 +4,7 @@
 #include "Algorithms/DoubleBoundedPID.h"
 
 /*
-0.8: P 0.123 D 0.027 Min 0.12
+0.8: P 0.123 D 0.0135 Min 0.12
 
 */
 
@@ -14,12 +14,12 @@ public:
 
     ForwardTest():
         AbstractTest(
-            {0.1, 0.027, 0.12, 0.03, 0.075, 0.8},
+            {0.1, 0.0135, 0.12, 0.03, 0.075, 0.8},
             {"P", "D", "MIN", "ACCEL", "TOLERANCE", "SPEED"}
         )
     {}
 
-    #define GFU_TURN SimplePID({1, 1.5, 0, 0.0, 1})
+    #define GFU_TURN SimplePID({1, 3, 0, 0.0, 1})
     double runFunction(Robot& robot) override {
 
         double p = paramValues[0];
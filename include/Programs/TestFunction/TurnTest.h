@@ -9,7 +9,7 @@ public:
 
     TurnTest():
         AbstractTest(
-            {1.25, 0.005, 0.13, 0.17, 0.5},
+            {1.25, 0.01, 0.065, 0.17, 0.5},
             {"P", "I", "D", "MIN", "TOLERANCE"}
         )
     {}
@@ -3,12 +3,15 @@
 #include "main.h"
 #include "misc/MathUtility.h"
 #include "pros/motors.h"
+#include "Subsystems/SensorSnapshot.h"
+#include "misc/CachedMotor.h"
+#include "misc/PeriodicLoop.h"
 
 class Drive {
 
 private:
 
-    pros::MotorGroup leftMotors, rightMotors;
+    CachedMotorGroup leftMotors, rightMotors;
     const double MOTOR_ROT_TO_LINEAR_INCHES;
 
     double leftPositionAtZero;
@@ -21,6 +24,9 @@ public:
 
     const double TRACK_WIDTH;
 
+    // Timing of the 10ms control loops of every motion function run on this drive
+    LoopTiming motionTiming;
+
     Drive(std::initializer_list<int8_t> left, std::initializer_list<int8_t> right,
     pros::motor_gearset_e_t internalGearRatio, double externalGearRatio, double wheelDiameterInches,
     double trackWidthInches);
@@ -47,7 +53,18 @@ public:
     // Get average distance travelled by the left and right wheels in linear inches
     double getDistance();
 
+    // Read every drive motor's position into the snapshot
+    void sample(SensorSnapshot& snapshot);
+
+    // Same as above, but from a snapshot instead of the motors
+    double getLeftDistance(const SensorSnapshot& snapshot);
+    double getRightDistance(const SensorSnapshot& snapshot);
+    double getDistance(const SensorSnapshot& snapshot);
+
     // get motor current for motors in amps
     double getCurrent();
 
+    // move_voltage commands sent and suppressed as repeats, both sides combined
+    MotorOutputStats getOutputStats();
+
 };
\ No newline at end of file
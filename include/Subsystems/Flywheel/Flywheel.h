@@ -2,8 +2,22 @@
 #include "misc/MathUtility.h"
 #include <vector>
 #include "Algorithms/ConversionData.h"
+#include "misc/PeriodicLoop.h"
+#include "misc/CachedMotor.h"
 #include "main.h"
 
+// Flywheel motor velocities read at one instant. Fixed size, so sampling every tick doesn't allocate
+typedef struct FlywheelSample {
+
+    static constexpr int MAX_MOTORS = 4;
+
+    uint64_t time = 0; // micros(), 0 if never sampled
+    int motorCount = 0;
+    double motorVelocity[MAX_MOTORS] = {}; // raw motor rpm, as get_actual_velocities() gave
+    double rpm = 0; // flywheel rpm from the first motor, what the controller uses
+    double averageRPM = 0; // flywheel rpm averaged over all motors
+} FlywheelSample;
+
 // 3600 rpm 1:1 cart, but programmed as default 200rpm cart
 class Flywheel {
 
@@ -21,32 +35,51 @@ protected:
 
     bool isOn = false;
 
+    LoopTiming loopTiming;
+
+    uint8_t ports[FlywheelSample::MAX_MOTORS];
+    int portCount = 0;
+    FlywheelSample latest;
+    pros::Mutex sampleMutex; // the executive samples while autonomous and driver code read
+
 public:
-    pros::MotorGroup motors;
+
+    static constexpr uint64_t SAMPLE_MAX_AGE = 2000; // us, well under the 10 ms control period
+
+    CachedMotorGroup motors;
 
     std::vector<DataPoint> rpmDistanceDown, rpmDistanceUp;
 
     Flywheel(std::initializer_list<int8_t> flywheelMotors, std::vector<DataPoint> voltRpmData, std::vector<DataPoint> rpmDistanceFlapDownData, std::vector<DataPoint> rpmDistanceFlapUpData, double startSpeed):
-        motors(flywheelMotors),
         data(voltRpmData),
+        targetRPM(startSpeed),
+        motors(flywheelMotors),
         rpmDistanceDown(rpmDistanceFlapDownData),
-        rpmDistanceUp(rpmDistanceFlapUpData),
-        targetRPM(startSpeed)
+        rpmDistanceUp(rpmDistanceFlapUpData)
     {
         motors.set_gearing(pros::E_MOTOR_GEAR_100);
+        for (int8_t port : flywheelMotors) {
+            if (portCount < FlywheelSample::MAX_MOTORS) ports[portCount++] = abs(port);
+        }
     }
 
     void setVelocity(double velocity);
     double getTargetVelocity();
-    double getCurrentVelocity();
-    virtual void maintainVelocityTask();
+    double getCurrentVelocity(); // uses the latest sample if it is fresh
+    FlywheelSample sampleVelocity(); // always read the motors
+    FlywheelSample getVelocitySample(); // latest sample if taken within SAMPLE_MAX_AGE, otherwise a new one
+    void maintainVelocityTask(); // blocking task that runs maintainVelocity() every 10 ms
+    virtual void maintainVelocity(); // one step of the velocity controller, for running from the Executive
     double getTargetVoltage();
     
     bool atTargetVelocity();
 
     void setRawVoltage(double volts);
 
-    virtual double getNextMotorVoltage(double currentRPM) {return 0;}
+    virtual double getNextMotorVoltage(double /* currentRPM */) {return 0;}
+
+    const std::vector<DataPoint>& getVoltRpmData() {return data;}
+    const LoopTiming& getLoopTiming() {return loopTiming;}
 
 
 };
\ No newline at end of file
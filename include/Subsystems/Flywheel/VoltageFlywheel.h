@@ -8,5 +8,5 @@ public:
 
     VoltageFlywheel(std::initializer_list<int8_t> flywheelMotors, std::vector<DataPoint> voltRpmData, std::vector<DataPoint> rpmDistanceFlapDownData, std::vector<DataPoint> rpmDistanceFlapUpData, double startSpeed, double gainConstant);
     
-    void maintainVelocityTask() override;
+    void maintainVelocity() override;
 };
\ No newline at end of file
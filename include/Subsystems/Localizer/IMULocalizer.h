@@ -4,7 +4,22 @@
 #include "Localizer.h"
 #include "Subsystems/Drive/Drive.h"
 #include "Algorithms/FixedRingQueue.h"
+#include "Algorithms/SeqlockBuffer.h"
 
+// Both IMU readings from one sample and the heading fused from them
+typedef struct ImuHeading {
+    double heading = 0; // average of the valid IMUs, radians in [0, 2pi)
+    double headingA = 0, headingB = 0; // radians, CCW positive
+    bool validA = true, validB = true;
+    uint64_t time = 0; // micros(), 0 before the first sample
+} ImuHeading;
+
+/*
+Heading from two IMUs. One sampler reads both IMUs every SAMPLE_PERIOD, keeps the disconnect detection windows
+qA/qB and publishes the fused heading; getHeading() and sample() return that cached heading without reading the
+devices. The sampler is sampleImus(), run by the executive (see scheduleLocalizer). Until it runs, getHeading()
+samples on demand, reusing a sample younger than MAX_AGE.
+*/
 class IMULocalizer : public Localizer {
 
 protected:
@@ -17,21 +32,33 @@ protected:
 
     Drive& drive;
 
-    RingQueue qA, qB;
+    RingQueue qA, qB; // only touched by readImus()
+    pros::Mutex imuMutex; // serializes readImus() when getHeading() samples on demand
+    SeqlockBuffer<ImuHeading> imuHeading;
+    std::atomic<uint32_t> lastPeriodicSample{0}; // micros() of the last sampleImus(), 0 if it never ran
 
-    double getRawHeading();
+    ImuHeading readImus(); // read both IMUs, update the windows and publish
+    ImuHeading getImuHeading(); // cached, or a new sample if nothing samples periodically
 
 public:
 
+    static constexpr uint32_t SAMPLE_PERIOD = 10; // ms
+    static constexpr uint32_t MAX_AGE = 2000; // us, well under the period of the motion loops
+
     IMULocalizer(Drive& drivetrain, uint8_t imuPortA, uint8_t imuPortB):
-        drive(drivetrain),
         imuA(imuPortA),
         imuB(imuPortB),
+        drive(drivetrain),
         qA(5),
         qB(5)
     {}
 
     virtual double getHeading() override; // radians
+    virtual double getHeading(const SensorSnapshot& snapshot) override;
+
+    virtual void sample(SensorSnapshot& snapshot) override;
+    virtual void sampleImus() override;
+    virtual bool hasImus() override { return true; }
     
     virtual void updatePositionTask() override; // blocking task used to update (x, y, heading)
     virtual void init() override; // init imu
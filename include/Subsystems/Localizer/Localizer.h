@@ -1,14 +1,50 @@
 #pragma once
 
+#include "Subsystems/SensorSnapshot.h"
+#include "pros/rtos.hpp"
+#include <cstdint>
+
+// x, y and heading from the same localizer update, so they always agree with each other
+typedef struct PoseEstimate {
+    double x = 0, y = 0; // inches
+    double heading = 0; // radians
+    uint64_t time = 0; // micros() of the sensor sample the pose came from
+    uint32_t sequence = 0; // increments with every update, so readers can tell a new pose from a repeat
+} PoseEstimate;
+
 class Localizer {
 
+protected:
+    uint32_t resets = 0; // incremented by setHeading / setPosition
+
 public:
     virtual double getX() {return 0;} // inches
     virtual double getY() {return 0;} // inches
     virtual double getHeading() {return 0;} // radians
+    virtual double getHeading(const SensorSnapshot&) {return getHeading();} // without reading the IMUs again
+    // Use instead of getX(), getY() and getHeading() one after another, which can each see a different update
+    virtual PoseEstimate getPose() {
+        PoseEstimate pose;
+        pose.x = getX();
+        pose.y = getY();
+        pose.heading = getHeading();
+        pose.time = pros::micros();
+        return pose;
+    }
+
+    virtual void sample(SensorSnapshot&) {} // read the IMUs and GPS into the snapshot
+    virtual void sampleImus() {} // one step of the IMU sampler, for running from the Executive every 10 ms
+    virtual bool hasImus() {return false;} // whether sampleImus() needs to run
     
     virtual void updatePositionTask() {} // blocking task used to update (x, y, heading)
+    virtual void update() {} // one step of updatePositionTask, for running from the Executive
+    virtual void update(const SensorSnapshot&) {} // same, from a snapshot taken this tick
+    virtual bool hasUpdate() {return false;} // whether update() does anything and needs to run every tick
+    virtual uint32_t getUpdatePeriod() {return 10;} // ms between update() calls
+    virtual void printStatus() {} // debug info on the brain screen
     virtual void init() {};
-    virtual void setPosition(double x, double y) {}
-    virtual void setHeading(double headingRadians) {}
+    virtual void setPosition(double /* x */, double /* y */) {}
+    virtual void setHeading(double /* headingRadians */) {}
+
+    uint32_t getResets() {return resets;}
 };
\ No newline at end of file
@@ -2,9 +2,12 @@
 
 #include "main.h"
 #include "IMULocalizer.h"
+#include "PoseEKF.h"
+#include "Algorithms/SeqlockBuffer.h"
 #include "Subsystems/Drive/Drive.h"
 #include "Algorithms/FixedRingQueue.h"
 #include "misc/MathUtility.h"
+#include "misc/PeriodicLoop.h"
 
 class Odometry : public IMULocalizer {
 
@@ -12,15 +15,22 @@ private:
 
     pros::GPS gps;
 
+    PoseEKF filter;
+    pros::Mutex filterMutex; // update() and setPosition()/setHeading() run in different tasks. Readers don't take it
+    SeqlockBuffer<PoseEstimate> pose; // filter's output, published after every change
 
-    double currentX, currentY, currentHeading;
-    double odomX = 0, odomY = 0;
-    double prevLeftDistance, prevRightDistance, prevHeading;
+    void publishPose(uint64_t time);
 
-    bool isOn = false;
+    SensorSnapshot lastSnapshot; // readings used by the last update, for printStatus
+
+    LoopTiming loopTiming;
+    uint32_t updatePeriod = DEFAULT_UPDATE_PERIOD;
 
 public:
 
+    static constexpr uint32_t DEFAULT_UPDATE_PERIOD = 10; // ms
+    static constexpr uint32_t HIGH_RATE_PERIOD = 5; // ms, 200 Hz, as fast as the IMUs and GPS can report
+
     Odometry(Drive& drivetrain, uint8_t imuPortA, uint8_t imuPortB, uint8_t gpsPort, double gpsXOffset, double gpsYOffset):
         IMULocalizer(drivetrain, imuPortA, imuPortB),
         gps(gpsPort, gpsXOffset / METERS_TO_INCHES, gpsYOffset / METERS_TO_INCHES)
@@ -29,8 +39,22 @@ public:
     double getX() override; // inches
     double getY() override; // inches
     double getHeading() override;
+    double getHeading(const SensorSnapshot&) override { return getHeading(); } // filtered, not the IMUs
+    PoseEstimate getPose() override;
     
     void updatePositionTask() override; // blocking task used to update (x, y, heading)
+    void update() override;
+    void update(const SensorSnapshot& snapshot) override;
+    bool hasUpdate() override { return true; }
+    uint32_t getUpdatePeriod() override { return updatePeriod; }
+    // Shorter periods follow fast turns more closely. Also sets how often the IMUs and GPS report. Call before the
+    // updates are started or scheduled
+    void setUpdatePeriod(uint32_t periodMs);
+    void sample(SensorSnapshot& snapshot) override;
+    void printStatus() override;
 
     void setPosition(double x, double y) override;
+    void setHeading(double headingRadians) override;
+
+    const LoopTiming& getLoopTiming() { return loopTiming; }
 };
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Subsystems/SensorSnapshot.h"
+#include "Algorithms/Matrix.h"
+#include "Algorithms/TimedRing.h"
+#include <cstdint>
+
+// Noise model of PoseEKF. Standard deviations, in inches, radians and seconds
+typedef struct PoseEKFNoise {
+    double wheelSlip = 0.03; // distance error per inch the wheels travel
+    double wheelFloor = 0.002; // distance error per update, even when still
+    double imuTurn = 0.01; // heading error per radian the IMUs turn
+    double imuDrift = 0.002; // heading random walk, per sqrt(second)
+    double gyroBiasDrift = 0.0005; // gyro bias random walk, radians/second per sqrt(second)
+    double acceleration = 100; // velocity random walk, inches/second per sqrt(second)
+    double encoderVelocity = 2; // encoder velocity measurement, inches/second
+
+    double gpsLatency = 0.02; // seconds from the GPS seeing the robot to its reading being read. 0 for none
+    double gpsErrorLimit = 0.05; // meters. Readings reporting more error are ignored
+    double gpsPositionFloor = 0.5; // never trust the GPS position more than this, however low its reported error
+    double gpsHeading = 0.04; // about 2 degrees
+    double gpsGate = 16.3; // chi-squared limit of a GPS innovation, 3 degrees of freedom, 99.9%
+    int gpsReacquire = 100; // consecutive gated readings before the position is assumed lost and reset to the GPS
+} PoseEKFNoise;
+
+/*
+Extended Kalman filter over (x, y, heading, gyro bias, velocity), which replaced OdometryFilter's fixed-gain GPS blend
+in Odometry. Encoder travel and the IMU heading change drive the prediction, the encoder velocity and the GPS are
+measurements weighted by their covariance, and the GPS heading lets it learn the drift rate of the IMUs. Each update
+is a few hundred multiply-adds on fixed-size stack matrices, with no allocation.
+
+GPS readings are late by the time they are read. Rather than pulling the present pose towards where the robot was,
+which makes the estimate lag and oscillate during fast motion, a reading is fused into the estimate of the update it
+was measured at, and the updates since are redone from there.
+
+Same interface as sim::OdometryFilter, so the host replay tools can run either.
+*/
+class PoseEKF {
+
+public:
+
+    enum StateIndex { X, Y, HEADING, GYRO_BIAS, VELOCITY, STATES };
+
+    PoseEKFNoise noise;
+
+    bool started = false;
+    double currentX = 0, currentY = 0, currentHeading = 0; // estimate, heading in [0, 2pi)
+
+    void update(const SensorSnapshot& snapshot);
+    void setPosition(double x, double y);
+    // The IMUs were just set to heading too. imus holds their readings since, so the change isn't taken for a turn
+    void setHeading(double heading, const SensorSnapshot& imus);
+
+    double getStdDev(StateIndex index) const; // square root of the covariance diagonal
+    bool isPositionKnown() const { return positionKnown; }
+    double getGyroBias() const { return state(GYRO_BIAS, 0); } // radians/second
+    double getVelocity() const { return state(VELOCITY, 0); } // inches/second
+    uint32_t getGpsUsed() const { return gpsUsed; }
+    uint32_t getGpsGated() const { return gpsGated; }
+
+private:
+
+    static constexpr uint32_t HISTORY = 32; // updates kept for fusing late GPS readings, 320 ms at 100 Hz
+
+    // One update's inputs and the estimate after it, before any GPS reading
+    typedef struct Step {
+        uint64_t time;
+        double distance, imuTurn, imuDisagreement, dt;
+        Matrix<STATES, 1> state;
+        Matrix<STATES, STATES> covariance;
+    } Step;
+
+    TimedRing<Step, HISTORY> steps;
+
+    Matrix<STATES, 1> state;
+    Matrix<STATES, STATES> covariance;
+
+    bool positionKnown = false; // setPosition() before the first update
+    uint64_t prevTime = 0;
+    double prevLeftDistance = 0, prevRightDistance = 0, prevImuHeading = 0;
+    double prevImuHeadingA = 0, prevImuHeadingB = 0;
+    bool prevBothImus = false;
+    double prevGpsX = 0, prevGpsY = 0, prevGpsHeading = 0;
+    int gatedInRow = 0;
+    uint32_t gpsUsed = 0, gpsGated = 0;
+
+    void start(const SensorSnapshot& snapshot);
+    void predict(double distance, double imuTurn, double imuDisagreement, double dt);
+    void correctVelocity(double velocity);
+    void correctGps(const SensorSnapshot& snapshot);
+    bool fuseGps(const Matrix<3, 1>& measurement, const Matrix<3, 3>& measurementNoise);
+    void pushStep(uint64_t time, double distance, double imuTurn, double imuDisagreement, double dt);
+    void publish();
+};
@@ -3,6 +3,9 @@
 #include "Subsystems/Drive/Drive.h"
 #include "Subsystems/Flywheel/Flywheel.h"
 #include "Subsystems/Localizer/Localizer.h"
+#include "Subsystems/SensorSampler.h"
+#include "misc/Executive.h"
+#include "misc/CachedMotor.h"
 #include <memory>
 #include "main.h"
 
@@ -14,15 +17,18 @@ public:
     std::unique_ptr<Localizer> localizer;
     std::unique_ptr<Flywheel> flywheel;
 
-    std::unique_ptr<pros::MotorGroup> intake;
+    std::unique_ptr<CachedMotorGroup> intake;
     std::unique_ptr<pros::ADIDigitalOut> indexer;
 
-    std::unique_ptr<pros::MotorGroup> cata;
+    std::unique_ptr<CachedMotorGroup> cata;
     std::unique_ptr<pros::ADIDigitalIn> limitSwitch;
 
-    std::unique_ptr<pros::Motor> roller;
+    std::unique_ptr<CachedMotor> roller;
     std::unique_ptr<pros::ADIDigitalOut> shooterFlap;
 
     std::unique_ptr<pros::ADIDigitalOut> endgame;
 
+    std::unique_ptr<Executive> executive{new Executive()}; // runs the periodic subsystem loops
+    std::unique_ptr<SensorSampler> sensors{new SensorSampler()}; // latest reading of the drive, IMUs and GPS
+
 };
\ No newline at end of file
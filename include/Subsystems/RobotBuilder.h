@@ -3,4 +3,17 @@
 #include "Robot.h"
 
 Robot getRobot15(bool isSkills);
-Robot getRobot18(bool isSkills);
\ No newline at end of file
+Robot getRobot18(bool isSkills);
+
+// Every drive, IMU and GPS reading for this control tick. Shared with the executive if it already sampled this tick
+// Also checks the robot's subsystems as below
+SensorSnapshot sampleSensors(Robot& robot, uint8_t groups = SENSE_ALL);
+
+// Throw std::runtime_error if a localization or control callback of the robot's executive has stopped, so a motion
+// loop ends up in autonomous()'s shutdown instead of driving on a pose or flywheel that no longer updates
+void checkSubsystems(Robot& robot);
+
+// Run the sensor sampler, the localizer and its status display, or the flywheel velocity controller, from the robot's executive
+// and start it. Safe to call more than once
+void scheduleLocalizer(Robot& robot);
+void scheduleFlywheel(Robot& robot);
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Subsystems/SensorSnapshot.h"
+#include "Subsystems/Drive/Drive.h"
+#include "Subsystems/Localizer/Localizer.h"
+#include "pros/rtos.hpp"
+
+/*
+Keeps the latest SensorSnapshot so that everything running in one control tick (the executive's sensor, localizer
+and display stages, then the motion loop) shares one set of device reads instead of each reading the motors and
+IMUs again. get() reuses the latest snapshot if it was taken within MAX_AGE, holds the requested groups and the
+localizer has not been reset since, and samples fresh otherwise, so it also works when nothing samples in the
+background.
+*/
+class SensorSampler {
+
+public:
+
+    static constexpr uint32_t MAX_AGE = 2000; // us, well under the 10 ms sensor update rate
+
+    // groups picks which devices to read if a fresh sample is needed, e.g. turns only need SENSE_LOCALIZER
+    SensorSnapshot get(Drive& drive, Localizer& localizer, uint8_t groups = SENSE_ALL);
+    SensorSnapshot sample(Drive& drive, Localizer& localizer, uint8_t groups = SENSE_ALL); // always read the devices
+
+    uint32_t getSampleCount() { return samples; }
+    uint32_t getReuseCount() { return reuses; }
+
+private:
+
+    SensorSnapshot latest;
+    bool hasSample = false;
+    pros::Mutex mutex; // the executive samples while the motion loop reads
+
+    uint32_t samples = 0, reuses = 0;
+};
@@ -0,0 +1,29 @@
+#pragma once
+#include <cstdint>
+
+// Groups of devices a SensorSnapshot can hold
+enum SensorGroup : uint8_t {
+    SENSE_DRIVE = 1, // drive motor positions
+    SENSE_LOCALIZER = 2, // IMUs and GPS
+    SENSE_ALL = 3
+};
+
+// Every drive, IMU and GPS reading of one control tick. Filled by Drive::sample() and Localizer::sample()
+typedef struct SensorSnapshot {
+    uint64_t time = 0; // micros() when the sample was taken
+    uint8_t groups = 0; // SensorGroup flags of what was sampled
+
+    // Average wheel travel of each side in inches since power on. Use Drive::getLeftDistance(snapshot) etc. for
+    // the distance since the last resetDistance()
+    double leftPosition = 0, rightPosition = 0;
+
+    double imuHeadingA = 0, imuHeadingB = 0; // radians, CCW positive
+    bool imuValidA = false, imuValidB = false;
+    double imuHeading = 0; // average of the valid IMUs, radians in [0, 2pi)
+
+    bool hasGps = false;
+    double gpsX = 0, gpsY = 0, gpsHeading = 0; // inches, radians
+    double gpsError = 0; // meters, as reported by the sensor
+
+    uint32_t localizerResets = 0; // Localizer::getResets() when sampled
+} SensorSnapshot;
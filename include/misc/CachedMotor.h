@@ -0,0 +1,78 @@
+#pragma once
+
+#include "pros/motors.hpp"
+#include <cstdint>
+
+// move_voltage() and brake() calls a CachedMotorGroup or CachedMotor sent on to its motors, and the ones it dropped.
+// Counted per motor, so a group of four commanded once counts four
+typedef struct MotorOutputStats {
+    uint32_t written = 0;
+    uint32_t suppressed = 0;
+} MotorOutputStats;
+
+// Last voltage commanded to a motor or group, and whether a new command needs to be sent
+typedef struct MotorOutputCache {
+
+    static constexpr uint32_t REFRESH_TIME = 100; // ms. Resend an unchanged command this often in case a motor was replugged
+    static constexpr int32_t BRAKE = INT32_MIN; // stands in for brake() as the last command
+
+    bool valid = false;
+    int32_t voltage = 0; // mV, or BRAKE
+    uint32_t time = 0; // millis() of the last write
+    MotorOutputStats stats;
+
+    bool shouldWrite(int32_t voltage, int motorCount);
+    void invalidate() { valid = false; }
+} MotorOutputCache;
+
+/*
+Motor group that remembers the voltage it last commanded and drops move_voltage() calls repeating it, so control
+loops can set their outputs every tick without spending smart port bandwidth and CPU on identical commands.
+Repeated brake() calls are dropped the same way. Other commands (velocity, position) go straight through and
+clear the cache so the next voltage is sent.
+
+Call these through a CachedMotorGroup, not a pros::MotorGroup reference, or the cache is bypassed.
+*/
+class CachedMotorGroup : public pros::MotorGroup {
+
+public:
+
+    using pros::MotorGroup::MotorGroup;
+
+    std::int32_t move_voltage(const std::int32_t voltage);
+    std::int32_t operator=(std::int32_t voltage);
+    std::int32_t move(std::int32_t voltage);
+    std::int32_t move_velocity(const std::int32_t velocity);
+    std::int32_t move_absolute(const double position, const std::int32_t velocity);
+    std::int32_t move_relative(const double position, const std::int32_t velocity);
+    std::int32_t brake(void);
+
+    const MotorOutputStats& getOutputStats() { return cache.stats; }
+
+private:
+
+    MotorOutputCache cache;
+};
+
+// Same as CachedMotorGroup for a single motor. The motor commands are virtual, so this also works through a
+// pros::Motor reference
+class CachedMotor : public pros::Motor {
+
+public:
+
+    using pros::Motor::Motor;
+
+    std::int32_t move_voltage(const std::int32_t voltage) const override;
+    std::int32_t operator=(std::int32_t voltage) const override;
+    std::int32_t move(std::int32_t voltage) const override;
+    std::int32_t move_velocity(const std::int32_t velocity) const override;
+    std::int32_t move_absolute(const double position, const std::int32_t velocity) const override;
+    std::int32_t move_relative(const double position, const std::int32_t velocity) const override;
+    std::int32_t brake(void) const override;
+
+    const MotorOutputStats& getOutputStats() { return cache.stats; }
+
+private:
+
+    mutable MotorOutputCache cache;
+};
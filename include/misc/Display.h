@@ -0,0 +1,97 @@
+#pragma once
+
+#include "pros/rtos.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+/*
+Low priority service that owns the brain screen, so control loops never wait on LCD I/O. print() and plot() only
+write a back buffer and bump its version; the display task redraws, at most once per FRAME_PERIOD, the lines
+whose text actually changed and the graph if it got new points since the last frame.
+
+Nobody ever blocks: each line and the graph is a small seqlock that the display task skips while it is being
+written and picks up next frame. Several tasks write the same lines (status on line 0 from the drive, localizers
+and autonomous), so a writer first claims the buffer and drops its post if another writer is mid-copy. A dropped
+status line is replaced by the next post a tick later anyway.
+*/
+class Display {
+
+public:
+
+    static constexpr int LINES = 8; // LLEMU lines
+    static constexpr int LINE_LENGTH = 64;
+    static constexpr uint32_t FRAME_PERIOD = 100; // ms
+
+    // Graph area on the right of the screen, in pixels
+    static constexpr int GRAPH_POINTS = 160;
+    static constexpr int GRAPH_LEFT = 300, GRAPH_TOP = 20, GRAPH_RIGHT = 470, GRAPH_BOTTOM = 180;
+
+    void print(int line, const char* format, ...);
+    void clearLine(int line);
+    void clear();
+    void setAlert(bool on); // red box in the corner of the screen, e.g. for a bad GPS reading
+
+    // Append a point to the scrolling graph, which keeps the last GRAPH_POINTS of them. Values outside the
+    // range are drawn clamped to its edge
+    void plot(float value);
+    void setGraphRange(float low, float high);
+    void clearGraph();
+
+    // Start the display task if it isn't already running
+    void start(uint32_t taskPriority = TASK_PRIORITY_MIN);
+
+    // Draw the changed lines and graph now. Called by the display task every frame
+    void drawFrame();
+
+    uint32_t getPosts() { return posts; }
+    uint32_t getDropped() { return dropped; } // posts lost to another writer of the same buffer
+    uint32_t getFrames() { return frames; }
+    uint32_t getLinesDrawn() { return linesDrawn; }
+    uint32_t getGraphsDrawn() { return graphsDrawn; }
+
+private:
+
+    typedef struct Line {
+        std::atomic<uint32_t> version{0}; // odd while being written
+        std::atomic<bool> claimed{false}; // one writer at a time, so version and text stay consistent
+        char text[LINE_LENGTH] = "";
+    } Line;
+
+    typedef struct GraphState {
+        float points[GRAPH_POINTS] = {}; // ring, oldest point at next once full
+        int count = 0;
+        int next = 0;
+        float low = 0, high = 1;
+    } GraphState;
+
+    Line lines[LINES];
+    std::atomic<bool> alert{false};
+
+    std::atomic<uint32_t> graphVersion{0}; // odd while being written
+    std::atomic<bool> graphClaimed{false};
+    GraphState graph;
+
+    // Front buffers, only touched by the display task
+    char shown[LINES][LINE_LENGTH] = {};
+    uint32_t shownVersion[LINES] = {};
+    bool shownAlert = false;
+    GraphState shownGraph;
+    uint32_t shownGraphVersion = 0;
+
+    std::atomic<uint32_t> posts{0}, dropped{0};
+    uint32_t frames = 0, linesDrawn = 0, graphsDrawn = 0;
+
+    std::unique_ptr<pros::Task> task;
+
+    void post(int line, const char* text);
+
+    // Claim the graph and open its seqlock, or count a dropped post and return false
+    bool beginGraphWrite();
+    void endGraphWrite();
+
+    void drawGraph();
+};
+
+// The brain screen
+extern Display display;
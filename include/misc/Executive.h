@@ -0,0 +1,92 @@
+#pragma once
+
+#include "pros/rtos.hpp"
+#include "misc/PeriodicLoop.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// CPU use of one Executive callback. Times in microseconds
+typedef struct CallbackStats {
+    const char* name;
+    uint32_t period; // ms
+    int priority;
+
+    uint32_t runs = 0;
+    uint64_t totalTime = 0;
+    uint32_t lastTime = 0;
+    uint32_t maxTime = 0;
+    bool stopped = false; // threw an exception and will not run again
+    char stopReason[48] = ""; // what() of the exception, if it had one
+
+    double getMeanTime() const { return runs ? (double) totalTime / runs : 0; }
+} CallbackStats;
+
+/*
+Runs the periodic work of every subsystem (localization, flywheel control, display...) as callbacks from one
+task instead of one task per subsystem. Each tick, the callbacks that are due run back to back in priority order,
+lowest number first, so a stage always sees the output of the stage before it from the same tick.
+
+The executive task runs above the default priority and its ticks fall on the same millisecond grid as every
+PeriodicLoop, so a motion loop in the autonomous task wakes on the same tick right after localization has run.
+
+Callbacks must not block. If one throws, it is stopped, the rest keep running and the screen says which one and why.
+Code that depends on a callback (e.g. motion loops on the localizer) checks getStopped() and shuts down itself.
+Callbacks run without the executive's lock held, so one may add() another.
+*/
+class Executive {
+
+public:
+
+    // Suggested callback priorities, in the order the stages should run within a tick
+    static constexpr int SENSORS = 0;
+    static constexpr int LOCALIZATION = 10;
+    static constexpr int CONTROL = 20;
+    static constexpr int DISPLAY = 30;
+
+    // Register a callback to run every periodMs, offset by phaseMs. Returns false if one with this name
+    // already exists, so subsystems can be scheduled from several places without running twice
+    bool add(const char* name, uint32_t periodMs, int priority, std::function<void()> callback, uint32_t phaseMs = 0);
+
+    // Start the executive task if it isn't already running
+    void start(uint32_t taskPriority = TASK_PRIORITY_DEFAULT + 1, const char* taskName = "Executive");
+    // Stop after the current tick and wait for the task to finish. Not from a callback, which would wait forever
+    void stop();
+    bool isRunning() { return task != nullptr; }
+
+    // The first stopped callback with a priority of at most maxPriority (by default, any that a motion loop depends
+    // on), copied into stats. Returns false if there is none. Cheap while nothing has stopped
+    bool getStopped(CallbackStats& stats, int maxPriority = CONTROL);
+
+    int getCallbackCount();
+    CallbackStats getStats(int index); // in run order
+    const LoopTiming& getLoopTiming() { return loopTiming; }
+    uint32_t getTickPeriod();
+
+private:
+
+    typedef struct Callback {
+        CallbackStats stats;
+        uint32_t phase;
+        std::function<void()> function;
+    } Callback;
+
+    // Callbacks may be added while the task runs, so they are held by pointer: a running callback stays put
+    // when the vector grows. Never removed
+    std::vector<std::unique_ptr<Callback>> callbacks;
+    std::vector<Callback*> due; // this tick's callbacks, only used by the task
+    pros::Mutex mutex; // guards callbacks, stats, tickPeriod and tickTime
+
+    uint32_t tickPeriod = 0; // ms, greatest common divisor of the callback periods and phases, so every one is a tick
+    uint32_t tickTime = 0; // ms since the task started
+    LoopTiming loopTiming;
+
+    std::atomic<int> stoppedCount{0};
+    std::atomic<bool> stopping{false}, finished{false};
+    std::unique_ptr<pros::Task> task;
+
+    void run();
+    void tick();
+};
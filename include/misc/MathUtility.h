@@ -84,4 +84,19 @@ inline double headingToPoint(double startX, double startY, double goalX, double
 // Distance between point (x0, y0) and line (x1, y1,),(x2,y2)
 inline double distancePointToLine(double x0, double y0, double x1, double y1, double x2, double y2) {
     return ((x2-x1)*(y1-y0) - (x1-x0)*(y2-y1)) / getDistance(x1, y1, x2, y2);
-}
\ No newline at end of file
+}
+
+// sin(x) / x, using its Taylor series near 0 where the division loses precision
+inline double sinc(double x) {
+    double x2 = x * x;
+    if (x2 < 1e-4) return 1 - x2 / 6 + x2 * x2 / 120;
+    return sin(x) / x;
+}
+
+// Move (x, y) along an arc of length distance, starting at heading and turning by turn radians. Exact for constant
+// curvature, including driving straight (turn = 0)
+inline void integrateArc(double& x, double& y, double heading, double distance, double turn) {
+    double chord = distance * sinc(turn / 2); // the chord points halfway through the turn
+    x += chord * cos(heading + turn / 2);
+    y += chord * sin(heading + turn / 2);
+}
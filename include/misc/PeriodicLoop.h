@@ -0,0 +1,55 @@
+#pragma once
+#include <cstdint>
+
+// How well a PeriodicLoop has held its period. Times in microseconds
+typedef struct LoopTiming {
+    uint32_t iterations = 0;
+    uint32_t overruns = 0; // iterations whose body ran past the next deadline
+    uint32_t missedPeriods = 0; // period boundaries skipped by resyncing after an overrun of a whole period or more
+    uint64_t totalJitter = 0; // sum of how late each iteration started after its deadline
+    uint32_t maxJitter = 0;
+    uint32_t lastBodyTime = 0; // time spent in the loop body, excluding the wait
+    uint32_t maxBodyTime = 0;
+
+    double getMeanJitter() const { return iterations ? (double) totalJitter / iterations : 0; }
+} LoopTiming;
+
+/*
+Runs a loop at a fixed period with task_delay_until instead of pros::delay, so the period does not
+stretch by however long the loop body takes. Call wait() once at the end of every iteration:
+
+    PeriodicLoop loop(10);
+    while (true) {
+        ...
+        loop.wait();
+    }
+
+Deadlines fall on multiples of the period since boot, so loops with the same period wake on the same
+tick and task priority decides which runs first (see Executive). The first deadline is the first
+boundary at least a whole period after the loop was constructed.
+
+If the body overruns its deadline, the next iteration starts at once and the loop keeps its deadlines.
+Only when it is a whole period or more late does it resync to the last boundary, skipping the periods
+it missed instead of bursting through them to catch up.
+*/
+class PeriodicLoop {
+
+public:
+
+    // timing accumulates into an external LoopTiming if given, so several short loops (e.g. every
+    // motion function) can share one record
+    PeriodicLoop(uint32_t periodMs, LoopTiming* timing = nullptr);
+
+    void wait();
+
+    uint32_t getPeriod() const { return period; }
+    const LoopTiming& getTiming() const { return *timing; }
+
+private:
+
+    uint32_t period; // ms
+    uint32_t previousWake; // ms, as used by task_delay_until
+    uint64_t iterationStart; // us
+    LoopTiming ownTiming;
+    LoopTiming* timing;
+};
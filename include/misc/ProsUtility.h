@@ -1,12 +1,19 @@
 #pragma once
 #include "main.h"
 #include "pros/motors.hpp"
+#include "misc/CachedMotor.h"
 
 inline void setEffort(pros::MotorGroup& motor, double effort) {
     int32_t mv = effort * 12000;
     motor.move_voltage(mv);
 }
 
+// Only sends the command if it changed, see CachedMotorGroup
+inline void setEffort(CachedMotorGroup& motor, double effort) {
+    int32_t mv = effort * 12000;
+    motor.move_voltage(mv);
+}
+
 inline void setEffort(pros::Motor& motor, double effort) {
     int32_t mv = effort * 12000;
     motor.move_voltage(mv);
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Algorithms/SPSCRing.h"
+#include "misc/TelemetryFormat.h"
+#include "pros/rtos.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <memory>
+
+/*
+Logging for control loops that costs a constant-time push instead of a printf. log() copies the values into the
+channel's lock-free ring; a low priority task merges the rings back into logging order, encodes them (see TelemetryFormat.h)
+and writes them in batches to a file (the SD card, or stdout for serial) every DRAIN_PERIOD, so a loop can log every tick without its timing
+changing. If the drain falls behind, new records are dropped and counted rather than blocking the loop.
+
+Nothing is recorded until start() is called.
+*/
+class Telemetry {
+
+public:
+
+    static constexpr uint32_t RING_CAPACITY = 256; // records per channel, 2.5 s of a 10 ms loop
+    static constexpr uint32_t DRAIN_PERIOD = 50; // ms
+
+    void log(TelemetryChannel channel, std::initializer_list<float> values);
+    // Same as above, stamped with time (micros()) instead of the time of the call
+    void log(TelemetryChannel channel, uint32_t time, std::initializer_list<float> values);
+
+    // Write the log header to sink and start recording. sink stays open for the life of the program
+    bool open(FILE* sink);
+    // open() and start the drain task. start(stdout) logs to serial instead of the SD card
+    void start(FILE* sink, uint32_t taskPriority = TASK_PRIORITY_MIN);
+    // A new file on the SD card each boot, sdPrefix then a number (telemetry_0000.bin, telemetry_0001.bin...), so
+    // a power cycle never overwrites the last match's log. The next number is kept in sdPrefix "next.txt".
+    // Returns false, recording nothing, if there is no card
+    bool start(const char* sdPrefix = "/usd/telemetry_", uint32_t taskPriority = TASK_PRIORITY_MIN);
+
+    // Write out everything queued
+    void drain();
+    void drainTask(); // blocking task that runs drain() every DRAIN_PERIOD
+
+    bool isRunning() { return running; }
+    uint32_t getWritten() { return written; } // records
+    uint32_t getBytesWritten() { return bytesWritten; }
+    uint32_t getDropped();
+
+private:
+
+    SPSCRing<TelemetryRecord, RING_CAPACITY> rings[TELEMETRY_CHANNELS];
+    std::atomic<bool> running{false};
+    std::atomic<uint32_t> sequence{0};
+    FILE* sink = nullptr;
+    TelemetryEncoder encoder;
+    uint8_t buffer[1024]; // one batch of encoded records
+    uint32_t written = 0, bytesWritten = 0;
+
+    std::unique_ptr<pros::Task> task;
+};
+
+extern Telemetry telemetry;
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+
+/*
+Binary telemetry log format. A log is a header describing every channel followed by records:
+
+    header:  "TLM" version
+             channel count
+             per channel: id, value count, name\0, then per value: field name\0, scale (varint)
+    record:  channel id
+             time since the channel's previous record, in us (varint)
+             per value: change in round(value * scale) since the channel's previous record (zigzag varint)
+
+Values are fixed point at their field's scale and delta coded per channel, so a value that changes slowly between
+ticks takes one byte. The header makes a log self-describing: the decoder needs no knowledge of the channels.
+*/
+
+// What a telemetry record holds. Each channel has its own ring, so each must only be logged from one task
+enum TelemetryChannel : uint8_t {
+    TELEMETRY_MOTION, // DriveFunctions loops
+    TELEMETRY_ODOMETRY, // Odometry::update
+    TELEMETRY_FLYWHEEL, // Flywheel::maintainVelocity
+    TELEMETRY_SHOOTER, // Shooter::tickIntakeShootingSpeed
+    TELEMETRY_SENSORS, // Odometry::update inputs, for replaying localization
+    TELEMETRY_ODOMETRY_START, // Odometry's first update, and whether setPosition() came before it
+    TELEMETRY_ODOMETRY_SET_POSITION, // Odometry::setPosition
+    TELEMETRY_ODOMETRY_SET_HEADING, // Odometry::setHeading, and the IMU readings right after
+    TELEMETRY_CHANNELS
+};
+
+// One fixed-size log entry, before encoding
+typedef struct TelemetryRecord {
+    static constexpr int MAX_VALUES = 12;
+
+    uint32_t time; // micros()
+    uint32_t sequence; // push order across all channels. Not encoded
+    uint8_t channel;
+    uint8_t count; // values used
+    float values[MAX_VALUES];
+} TelemetryRecord;
+
+typedef struct TelemetrySchema {
+    const char* name;
+    uint8_t count;
+    const char* fields[TelemetryRecord::MAX_VALUES];
+    uint32_t scales[TelemetryRecord::MAX_VALUES]; // fixed point steps per unit
+} TelemetrySchema;
+
+extern const TelemetrySchema TELEMETRY_SCHEMAS[TELEMETRY_CHANNELS];
+
+constexpr uint8_t TELEMETRY_VERSION = 1;
+constexpr int TELEMETRY_MAX_CHANNELS = 32;
+constexpr int TELEMETRY_MAX_RECORD_BYTES = 1 + 5 + 5 * TelemetryRecord::MAX_VALUES;
+
+// Varints are little endian base 128. Return bytes written or read; reads return 0 if the buffer ends first
+int putVarint(uint8_t* out, uint32_t value);
+int getVarint(const uint8_t* in, int available, uint32_t& value);
+inline uint32_t zigzag(int32_t value) { return ((uint32_t) value << 1) ^ (uint32_t) (value >> 31); }
+inline int32_t unzigzag(uint32_t value) { return (int32_t) (value >> 1) ^ -(int32_t) (value & 1); }
+
+// Turns records into the format above. Keeps the per-channel state the deltas need
+class TelemetryEncoder {
+
+public:
+
+    int writeHeader(uint8_t* out, int capacity); // bytes written, 0 if it doesn't fit
+    int encode(const TelemetryRecord& record, uint8_t* out); // out must hold TELEMETRY_MAX_RECORD_BYTES
+
+private:
+
+    uint32_t lastTime[TELEMETRY_CHANNELS] = {};
+    int32_t lastValues[TELEMETRY_CHANNELS][TelemetryRecord::MAX_VALUES] = {};
+};
+
+// Reads a log back using only its header. For host tools
+class TelemetryDecoder {
+
+public:
+
+    typedef struct Channel {
+        bool defined = false;
+        char name[32] = "";
+        uint8_t count = 0;
+        char fields[TelemetryRecord::MAX_VALUES][32] = {};
+        uint32_t scales[TelemetryRecord::MAX_VALUES] = {};
+    } Channel;
+
+    int readHeader(const uint8_t* in, int available); // bytes read, 0 if incomplete, -1 if not a telemetry log
+    // Bytes read, 0 if the record is incomplete, -1 if it is corrupt. values are in the field's units
+    int decode(const uint8_t* in, int available, uint8_t& channel, uint32_t& time, double* values);
+
+    const Channel& getChannel(uint8_t id) { return channels[id]; }
+
+private:
+
+    Channel channels[TELEMETRY_MAX_CHANNELS];
+    uint32_t lastTime[TELEMETRY_MAX_CHANNELS] = {};
+    int32_t lastValues[TELEMETRY_MAX_CHANNELS][TelemetryRecord::MAX_VALUES] = {};
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Simulation/Plant.h"
+#include "Simulation/World.h"
+
+namespace sim {
+
+// A slip gear catapult: the arm winds down and fires once per arm revolution
+typedef struct CataParameters {
+    std::vector<int8_t> ports; // negative ports are mounted reversed
+    uint8_t limitSwitchPort; // ADI port, 'A'-'H'
+    double armRatio = 1.0 / 3.0; // arm revolutions per motor revolution
+    double loadInertia = 0.01; // kg m^2 at each motor's output shaft, for the arm and rubber bands
+    double switchWindow = 0.35; // radians of arm travel over which the limit switch is held down
+} CataParameters;
+
+// The catapult of the 18" robot built by getRobot18
+CataParameters getRobot18Cata();
+
+/*
+Kinematic catapult. The motors spin freely against loadInertia and the limit switch reads pressed while
+the arm is within switchWindow of its loaded position, which is enough for code that runs the cata until
+the switch closes.
+*/
+class CataPlant : public Plant {
+
+public:
+
+    CataPlant(World& world, CataParameters parameters);
+    ~CataPlant();
+
+    CataPlant(const CataPlant&) = delete;
+    CataPlant& operator=(const CataPlant&) = delete;
+
+    void step(double dt) override;
+
+    int getShots() const { return shots; } // number of times the arm has fired
+
+private:
+
+    World& world;
+    CataParameters params;
+    SimMotor* motor = nullptr; // the arm follows the first motor
+    double mount = 1;
+    int shots = 0;
+};
+
+} // namespace sim
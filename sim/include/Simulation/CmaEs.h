@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace sim {
+
+/*
+Covariance matrix adaptation evolution strategy, a derivative free minimizer for a handful of noisy,
+badly scaled parameters such as PID gains. Each generation, ask() samples candidates from a multivariate
+normal distribution; after they are evaluated (in any order, e.g. on several threads), tell() moves the
+distribution towards the best ones and adapts its shape and step size.
+
+Follows N. Hansen, "The CMA Evolution Strategy: A Tutorial" (2016), with the default strategy parameters.
+*/
+class CmaEs {
+
+public:
+
+    // populationSize 0 picks the default of 4 + 3 ln(n)
+    CmaEs(std::vector<double> initialMean, double initialSigma, int populationSize = 0, uint32_t seed = 1);
+
+    std::vector<std::vector<double>> ask();
+    void tell(const std::vector<std::vector<double>>& candidates, const std::vector<double>& costs);
+
+    const std::vector<double>& getMean() const { return mean; }
+    double getSigma() const { return sigma; }
+    int getPopulationSize() const { return lambda; }
+
+private:
+
+    typedef std::vector<std::vector<double>> Matrix;
+
+    int n, lambda, mu;
+    std::vector<double> weights;
+    double muEff, cc, cs, c1, cMu, damps, chiN;
+
+    std::vector<double> mean;
+    double sigma;
+    std::vector<double> pc, ps;
+    Matrix C, B; // covariance and its eigenvectors (columns)
+    std::vector<double> D; // square roots of the eigenvalues
+    int generation = 0;
+
+    std::mt19937 random;
+
+    void decompose();
+};
+
+} // namespace sim
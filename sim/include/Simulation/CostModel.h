@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+namespace sim {
+
+/*
+Virtual CPU time, in microseconds, charged to the running task for each kind of PROS call.
+The simulator executes control code instantly, so without these charges every loop body would take
+zero time. The defaults are rough figures for the V5 brain: smart port getters/setters only touch the
+cached device packet, while LLEMU/screen calls go through LVGL and are far more expensive.
+*/
+typedef struct CostModel {
+    uint32_t deviceRead = 2;
+    uint32_t deviceWrite = 3;
+    uint32_t lcdPrint = 150;
+    uint32_t lcdClear = 400;
+    uint32_t screenDraw = 120;
+    uint32_t screenErase = 1500;
+} CostModel;
+
+// Number of PROS calls issued since the world was created, by kind
+typedef struct DeviceStats {
+    uint64_t deviceReads = 0;
+    uint64_t deviceWrites = 0;
+    uint64_t lcdCalls = 0;
+    uint64_t screenCalls = 0;
+} DeviceStats;
+
+} // namespace sim
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "Simulation/Plant.h"
+#include "Simulation/World.h"
+
+namespace sim {
+
+// Geometry and physical constants of a tank drivetrain. Ports and geometry use the same conventions as
+// the Drive constructor, so they can be copied straight from RobotBuilder
+typedef struct DrivetrainParameters {
+    std::vector<int8_t> leftPorts, rightPorts; // negative ports are mounted reversed
+    double externalGearRatio; // wheel revolutions per motor revolution
+    double wheelDiameter; // inches
+    double trackWidth; // inches
+
+    std::vector<uint8_t> imuPorts;
+    uint8_t gpsPort = 0; // 0 for none
+
+    double mass = 6.8; // kg
+    double momentOfInertia = 0.16; // kg m^2 about the turning center
+    double wheelInertia = 2e-4; // kg m^2 for all the wheels and gears on one side
+    double traction = 1.0; // friction coefficient between wheels and tiles
+    double slipVelocity = 0.05; // m/s of wheel slip at which ~75% of the available traction is used
+    double rollingResistance = 0.03; // fraction of the robot's weight
+    double scrubTorque = 1.0; // Nm needed to skid the wheels sideways while turning
+} DrivetrainParameters;
+
+// The drivetrain of the 15" robot built by getRobot15
+DrivetrainParameters getRobot15Drivetrain();
+
+// The drivetrain of the 18" robot built by getRobot18
+DrivetrainParameters getRobot18Drivetrain();
+
+/*
+Rigid body model of a tank drive on foam tiles. Each side is a wheel with the motors' reflected inertia
+that is driven by the motor torque-speed curves and pushes on the robot through a smooth slip/traction
+model, so hard accelerations and turns lose ground like the real robot. The motors on both sides are
+attached to the plant, and the IMUs and GPS listed in the parameters follow the robot's true pose.
+
+The pose uses the repo's conventions: inches, heading in radians counterclockwise.
+*/
+class DrivetrainPlant : public Plant {
+
+public:
+
+    DrivetrainPlant(World& world, DrivetrainParameters parameters);
+    ~DrivetrainPlant();
+
+    DrivetrainPlant(const DrivetrainPlant&) = delete;
+    DrivetrainPlant& operator=(const DrivetrainPlant&) = delete;
+
+    void step(double dt) override;
+
+    // Place the robot. Resets all velocities
+    void setPose(double x, double y, double heading);
+
+    double getX() const; // inches
+    double getY() const; // inches
+    double getHeading() const { return heading; } // radians, continuous
+    double getVelocity() const; // inches/sec, forwards
+    double getAngularVelocity() const { return angularVelocity; } // radians/sec
+
+    // Difference between wheel surface speed and ground speed, inches/sec
+    double getLeftSlip() const;
+    double getRightSlip() const;
+
+    const DrivetrainParameters& getParameters() const { return params; }
+
+private:
+
+    static constexpr int SUBSTEPS = 4; // contact forces are stiff, so integrate at 4x the physics rate
+
+    typedef struct Side {
+        std::vector<SimMotor*> motors;
+        std::vector<double> mounts; // +1 or -1
+        double wheelVelocity = 0; // rad/s
+        double groundForce = 0; // N, last traction force
+    } Side;
+
+    World& world;
+    DrivetrainParameters params;
+    Side left, right;
+
+    double x = 0, y = 0; // meters
+    double heading = 0;
+    double velocity = 0; // m/s
+    double angularVelocity = 0;
+
+    double wheelRadius, halfTrack; // meters
+
+    // Recent true poses, for a GPS that reports them late
+    typedef struct TimedPose {
+        uint64_t time;
+        double x, y, yaw, yawRate;
+    } TimedPose;
+    std::deque<TimedPose> gpsHistory;
+
+    void attach(Side& side, const std::vector<int8_t>& ports);
+    double sideTorque(Side& side); // Nm at the wheel
+    double sideInertia(const Side& side); // kg m^2 at the wheel
+    void updateSensors();
+};
+
+} // namespace sim
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Algorithms/ConversionData.h"
+#include "Simulation/Plant.h"
+#include "Simulation/World.h"
+
+namespace sim {
+
+// Physical constants of a flywheel driven directly by motor cores. Everything is referred to the motor
+// cores, which is also what Flywheel::getCurrentVelocity() reports (shaft velocity * 36)
+typedef struct FlywheelParameters {
+    std::vector<int8_t> ports; // negative ports are mounted reversed
+
+    double inertia = 3e-4; // kg m^2, flywheel and gears at the motor cores
+    double frictionTorque = 0; // Nm of coulomb friction at the motor cores, all motors together
+    double freeSpeedScale = 1; // passed to every motor, see SimMotor::freeSpeedScale
+    double velocityNoise = 0.1; // RMS noise on each motor's velocity reading, rpm at the shaft
+
+    double discMass = 0.065; // kg
+    double launchRadius = 0.025; // disc exit speed in m/s per rad/s of the motor cores
+    double contactTime = 0.04; // seconds the disc is squeezed against the flywheel
+} FlywheelParameters;
+
+// Fit freeSpeedScale and frictionTorque to a measured volt -> rpm table (steady state velocities at
+// constant voltage), like the one passed to the Flywheel constructor
+void fitVoltRpmData(FlywheelParameters& params, const std::vector<DataPoint>& voltRpmData);
+
+// The flywheel of the 15" robot built by getRobot15, fitted to its volt -> rpm table
+FlywheelParameters getRobot15Flywheel(const std::vector<DataPoint>& voltRpmData);
+
+/*
+Single inertia model of a flywheel: the motors' torque-speed curves spin up the wheel against friction,
+and launchDisc() loads it for contactTime while the disc is accelerated to its exit speed. The energy a
+disc takes is 1/2 m v^2 with v proportional to the wheel speed, so the load grows with velocity and the
+wheel sags by a similar fraction on every shot.
+*/
+class FlywheelPlant : public Plant {
+
+public:
+
+    FlywheelPlant(World& world, FlywheelParameters parameters);
+    ~FlywheelPlant();
+
+    FlywheelPlant(const FlywheelPlant&) = delete;
+    FlywheelPlant& operator=(const FlywheelPlant&) = delete;
+
+    void step(double dt) override;
+
+    // Feed a disc into the flywheel. It leaves contactTime later
+    void launchDisc();
+    bool isLaunching() const { return contactRemaining > 0; }
+    int getDiscsLaunched() const { return discsLaunched; }
+
+    // Exit speed of the last disc, m/s
+    double getLastExitVelocity() const { return lastExitVelocity; }
+
+    double getVelocity() const; // rpm at the motor cores, noise free
+
+    const FlywheelParameters& getParameters() const { return params; }
+
+private:
+
+    World& world;
+    FlywheelParameters params;
+    std::vector<SimMotor*> motors;
+    std::vector<double> mounts; // +1 or -1
+
+    double velocity = 0; // rad/s at the motor cores
+    double contactRemaining = 0; // seconds
+    double lastExitVelocity = 0;
+    int discsLaunched = 0;
+};
+
+} // namespace sim
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <functional>
+
+#include "Simulation/Plant.h"
+#include "Simulation/World.h"
+
+namespace sim {
+
+/*
+Calls a function after every physics step for as long as it exists, without issuing any PROS calls,
+so programs can follow the true state of a plant (peaks, settle times) without disturbing the timing of
+the code under test.
+*/
+class StepProbe : public Plant {
+
+public:
+
+    StepProbe(World& world, std::function<void()> onStep);
+    ~StepProbe();
+
+    StepProbe(const StepProbe&) = delete;
+    StepProbe& operator=(const StepProbe&) = delete;
+
+    void step(double dt) override { onStep(); }
+
+private:
+    World& world;
+    std::function<void()> onStep;
+};
+
+// The control code prints debugging output every tick. Redirect stdout to /dev/null and return a handle
+// that restoreStdout() uses to put it back
+int silenceStdout();
+void restoreStdout(int saved);
+
+} // namespace sim
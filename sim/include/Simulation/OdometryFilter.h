@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Subsystems/SensorSnapshot.h"
+
+namespace sim {
+
+// Tuning of OdometryFilter's GPS correction
+typedef struct OdometryGains {
+    double kPosition = 0.03; // fraction of the GPS position error corrected each update
+    double kHeading = 0.01;
+    double gpsErrorLimit = 0.015; // meters. Below this value the GPS reads stable values
+} OdometryGains;
+
+/*
+The fixed-gain filter Odometry ran before PoseEKF, without any devices: integrates encoder arcs along the IMU
+heading, and slowly pulls the result towards the GPS through a bias. Kept on the host only, so the tools can compare
+the two on the same data (see sim/programs/ReplayLocalization.cpp and LocalizationBenchmark.cpp).
+*/
+typedef struct OdometryFilter {
+
+    OdometryGains gains;
+
+    bool started = false;
+    double odomX = 0, odomY = 0; // encoders and IMU only
+    double biasX = 0, biasY = 0, biasHeading = 0; // GPS correction
+    double currentX = 0, currentY = 0, currentHeading = 0; // filtered
+    double prevLeftDistance = 0, prevRightDistance = 0, prevHeading = 0;
+
+    void update(const SensorSnapshot& snapshot);
+    void setPosition(double x, double y);
+    void setHeading(double heading, const SensorSnapshot& imus); // see PoseEKF::setHeading
+} OdometryFilter;
+
+} // namespace sim
@@ -0,0 +1,16 @@
+#pragma once
+
+namespace sim {
+
+/*
+A physical model stepped by the World at a fixed rate. Plants read the voltages the simulated motor
+firmware applies and write back shaft angles/velocities and sensor readings (IMU, GPS, ADI).
+*/
+class Plant {
+
+public:
+    virtual ~Plant() = default;
+    virtual void step(double dt) = 0; // dt in seconds
+};
+
+} // namespace sim
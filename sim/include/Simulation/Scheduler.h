@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <ucontext.h>
+
+namespace sim {
+
+class World;
+
+// Thrown inside a simulated task to unwind its stack when the task is removed
+struct TaskKilled {};
+
+enum class TaskState {READY, RUNNING, BLOCKED, SUSPENDED, DELETED};
+
+typedef struct SimTask {
+    std::string name;
+    uint32_t priority;
+    void (*function)(void*);
+    void* parameters;
+    std::function<void()> program; // what World::run started, owned by the task so it outlives run() timing out
+
+    TaskState state = TaskState::READY;
+    uint64_t wakeTime = 0; // microseconds, only meaningful while BLOCKED
+    uint64_t sequence = 0; // FIFO order between tasks of equal priority
+    bool killRequested = false;
+    uint32_t notifyValue = 0;
+
+    uint64_t cpuTime = 0; // virtual microseconds charged while this task was running
+    uint32_t switches = 0;
+
+    std::exception_ptr error; // exception that escaped the task function, if any
+
+    ucontext_t context;
+    std::unique_ptr<char[]> stack;
+} SimTask;
+
+/*
+Cooperative stand-in for the FreeRTOS scheduler on the brain. Every pros::Task runs on its own
+ucontext stack inside the host thread that owns the World, and only gives up the CPU in delay(),
+yield() or a blocking mutex/notify call. Virtual time advances when every task is blocked or when
+the running task is charged for a PROS call (see CostModel), so a simulation is deterministic and
+runs as fast as the host can execute the control code.
+*/
+class Scheduler {
+
+public:
+
+    static constexpr size_t STACK_BYTES = 256 * 1024;
+
+    Scheduler(World& worldP): world(worldP) {}
+    ~Scheduler();
+
+    SimTask* create(void (*function)(void*), void* parameters, uint32_t priority, const char* name);
+    void remove(SimTask* task);
+    void suspend(SimTask* task);
+    void resume(SimTask* task);
+
+    // Block the calling task until the virtual clock reaches wakeTime (microseconds)
+    void sleepUntil(uint64_t wakeTime);
+    void yield();
+
+    // Run tasks until the given task finishes or the clock reaches endTime. Returns true if the task finished
+    bool runUntilDone(SimTask* task, uint64_t endTime);
+
+    // Run tasks until the clock reaches endTime
+    void runUntil(uint64_t endTime);
+
+    // Unwind every task that is still alive
+    void killAll();
+
+    SimTask* current() { return running; }
+    SimTask* findByName(const char* name);
+    const std::vector<std::unique_ptr<SimTask>>& getTasks() { return tasks; }
+    uint32_t getTaskCount();
+
+private:
+
+    World& world;
+
+    std::vector<std::unique_ptr<SimTask>> tasks;
+    SimTask* running = nullptr;
+    ucontext_t dispatcherContext;
+    uint64_t nextSequence = 0;
+
+    SimTask* pickNext(uint64_t endTime);
+    void switchTo(SimTask* task);
+    void switchToDispatcher();
+    static void trampoline();
+};
+
+} // namespace sim
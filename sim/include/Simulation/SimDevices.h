@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <math.h>
+#include <string>
+
+namespace sim {
+
+enum class DeviceType {MOTOR, IMU, GPS};
+
+// Anything plugged into one of the 21 smart ports
+class SmartDevice {
+
+public:
+    const DeviceType type;
+    bool connected = true;
+
+    SmartDevice(DeviceType t): type(t) {}
+    virtual ~SmartDevice() = default;
+};
+
+/*
+An inertial sensor. The plant writes yaw as the robot's true continuous rotation, clockwise positive
+in degrees like the real sensor. Readings are offset by set_heading()/set_rotation() and unavailable
+while calibrating.
+*/
+class SimImu : public SmartDevice {
+
+public:
+    static constexpr uint32_t CALIBRATION_MICROS = 2000000;
+
+    SimImu(): SmartDevice(DeviceType::IMU) {}
+
+    double yaw = 0; // degrees, clockwise positive, continuous
+    double yawRate = 0; // degrees per second
+    double pitch = 0, roll = 0;
+
+    double headingOffset = 0;
+    double rotationOffset = 0;
+    double yawOffset = 0, pitchOffset = 0, rollOffset = 0;
+
+    uint64_t calibrationEnd = 0; // world time at which the current calibration finishes
+    uint32_t dataRate = 10; // ms
+
+    // RMS noise on heading/rotation readings. The real sensor is never perfectly still, and IMULocalizer
+    // treats a run of identical readings as a disconnected sensor
+    double noise = 0.005; // degrees
+    double scale = 1; // gain error of the gyro, e.g. 1.01 reads 1% too much rotation
+
+    bool isCalibrating(uint64_t now) const { return now < calibrationEnd; }
+    double getMeasuredYaw() const { return yaw * scale; }
+    double getRotation() const { return getMeasuredYaw() + rotationOffset; }
+    double getHeading() const { return fmod(fmod(getMeasuredYaw() + headingOffset, 360) + 360, 360); }
+};
+
+/*
+A GPS sensor. Position is in meters and heading is clockwise in degrees, as reported by the real sensor
+after its offset has been applied (i.e. the pose of the robot's tracking center).
+*/
+class SimGps : public SmartDevice {
+
+public:
+    SimGps(): SmartDevice(DeviceType::GPS) {}
+
+    double x = 0, y = 0; // meters
+    double heading = 0; // degrees, clockwise, [0, 360)
+    double rotation = 0; // degrees, clockwise, continuous
+    double yawRate = 0; // degrees per second
+    double error = 0.01; // RMS position error the sensor reports, meters
+    double latency = 0.02; // seconds between the robot being at a pose and the sensor reporting it
+    double rotationOffset = 0;
+
+    double offsetX = 0, offsetY = 0; // meters
+    uint32_t dataRate = 20; // ms
+};
+
+// One of the eight three-wire ports on the brain
+typedef struct SimAdiPort {
+    int32_t config = 0; // adi_port_config_e_t
+    int32_t value = 0;
+    bool lastDigital = false; // for get_new_press
+    int32_t calibration = 0;
+} SimAdiPort;
+
+// A V5 controller. Programs set analog/digital state to script driver input
+typedef struct SimController {
+    bool connected = true;
+    int32_t analog[4] = {0, 0, 0, 0}; // indexed by controller_analog_e_t
+    bool digital[12] = {false}; // indexed by controller_digital_e_t - DIGITAL_L1
+    bool lastDigital[12] = {false};
+    std::string lines[3];
+    int32_t battery = 100;
+} SimController;
+
+// The brain screen. LLEMU lines are kept as text; raw screen drawing is only counted
+typedef struct SimDisplay {
+    bool lcdInitialized = false;
+    std::string lines[8];
+    void (*buttonCallbacks[3])(void) = {nullptr, nullptr, nullptr};
+    uint8_t buttons = 0;
+
+    uint32_t pen = 0x00FFFFFF;
+    uint32_t eraser = 0;
+    uint64_t drawCalls = 0;
+    std::string lastPrint;
+} SimDisplay;
+
+} // namespace sim
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Simulation/SimDevices.h"
+#include "pros/motors.h"
+
+namespace sim {
+
+/*
+A V5 smart motor: the state the motor firmware keeps (gearset, brake mode, units, last command),
+its internal velocity/position loops, and a DC motor model with the 2.5A current limit.
+
+All physical quantities are for the output shaft in the motor's own direction, before the
+reversed flag is applied: angle in radians, velocity in rad/s, torque in Nm, voltage in volts.
+*/
+class SimMotor : public SmartDevice {
+
+public:
+
+    enum class Mode {VOLTAGE, VELOCITY, POSITION, BRAKE};
+
+    // Core motor constants (before the cartridge). 3600rpm free speed at 12V, 2.1Nm stall on the 36:1 cartridge
+    static constexpr double KE = 12.0 / (3600 * 2 * M_PI / 60); // V per rad/s
+    static constexpr double KT = 2.1 / 36 / 2.5; // Nm per A
+    static constexpr double RESISTANCE = 2.4; // ohms
+    static constexpr double ROTOR_INERTIA = 3e-6; // kg m^2
+    static constexpr double ROTOR_FRICTION = 2e-6; // Nm per rad/s
+
+    SimMotor(): SmartDevice(DeviceType::MOTOR) {}
+
+    pros::motor_gearset_e_t gearset = pros::E_MOTOR_GEARSET_18;
+    pros::motor_encoder_units_e_t units = pros::E_MOTOR_ENCODER_DEGREES;
+    pros::motor_brake_mode_e_t brakeMode = pros::E_MOTOR_BRAKE_COAST;
+    bool reversed = false;
+    int32_t currentLimit = 2500; // mA
+    int32_t voltageLimit = 0; // mV, 0 means no limit
+
+    // Last command, in the motor's own direction
+    Mode mode = Mode::VOLTAGE;
+    double targetVoltage = 0; // volts
+    double targetVelocity = 0; // rad/s
+    double targetAngle = 0; // rad
+    double profileVelocity = 0; // rad/s, speed cap for position moves
+    uint64_t voltageCommands = 0; // number of move_voltage() calls that reached the motor
+
+    // Physical state, written by stepFree() or by the Plant this motor is attached to
+    double angle = 0;
+    double velocity = 0;
+    double current = 0; // amps
+    double appliedVoltage = 0;
+    double torque = 0;
+    double temperature = 25; // celsius
+
+    double zeroAngle = 0; // angle at which get_position() reads 0
+    double loadInertia = 0; // extra inertia at the output shaft when free spinning, kg m^2
+    double strength = 1; // torque multiplier, for motor-to-motor variance
+    double freeSpeedScale = 1; // back-EMF divisor, for cores that run faster than nominal
+    double velocityNoise = 0; // RMS noise on velocity readings, rpm at the output shaft
+
+    bool attached = false; // true when a Plant integrates this shaft instead of stepFree()
+
+    double getGearRatio() const; // core revolutions per output revolution
+    double getMaxVelocity() const; // rad/s at the output shaft
+    double getTicksPerRevolution() const;
+
+    // Conversions between the motor's own direction and the caller's (reversed) direction
+    double direction() const { return reversed ? -1 : 1; }
+    double toUnits(double radians) const;
+    double fromUnits(double value) const;
+
+    // Run the motor firmware for dt seconds: turn the last command into an applied voltage
+    void updateFirmware(double dt, double batteryVoltage);
+
+    // Torque at the output shaft for the applied voltage at the given shaft velocity. Updates current draw
+    double computeTorque(double shaftVelocity);
+
+    // Integrate the shaft with only the rotor and loadInertia attached
+    void stepFree(double dt);
+
+private:
+
+    double velocityIntegral = 0;
+    double holdAngle = 0;
+    bool wasBraking = false;
+
+    double runVelocityLoop(double target, double dt);
+};
+
+} // namespace sim
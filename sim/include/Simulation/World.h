@@ -0,0 +1,114 @@
+#pragma once
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Simulation/CostModel.h"
+#include "Simulation/Plant.h"
+#include "Simulation/Scheduler.h"
+#include "Simulation/SimDevices.h"
+#include "Simulation/SimMotor.h"
+
+namespace sim {
+
+/*
+One simulated V5 brain: a virtual microsecond clock, the task scheduler, every smart/ADI device and
+the plants that move them. The stand-in PROS API (sim/src/Pros) resolves all calls against the World
+owned by the calling host thread, so independent worlds can run in parallel on separate threads.
+
+The robot code's services are still plain globals (display, telemetry, pathCache), one per process as there is one
+per brain. Worlds running in parallel share them, which is safe as long as only one world starts them: their tasks
+live in that world. What control code calls every tick (Display::print/plot, Telemetry::log while telemetry isn't
+running) only touches atomics, so a post from one world at worst drops another's, and never waits or costs time.
+
+Typical use:
+    sim::World world;
+    Robot robot = getRobot15(false);
+    world.run([&] { threeTileAuton(robot); }, 15);
+*/
+class World {
+
+public:
+
+    static constexpr int SMART_PORT_COUNT = 21;
+    static constexpr int ADI_PORT_COUNT = 8;
+
+    World(uint32_t physicsStepMicros = 1000);
+    ~World();
+
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    // The world owned by the calling thread. Throws if there is none
+    static World& current();
+    static bool exists();
+
+    Scheduler scheduler;
+    CostModel costs;
+    DeviceStats stats;
+
+    double batteryVoltage = 12.8; // volts
+    uint8_t competitionStatus = 0;
+    bool sdCardInstalled = true;
+
+    SimController controllers[2];
+    SimDisplay display;
+    std::array<SimAdiPort, ADI_PORT_COUNT> adi;
+
+    // Source of all sensor noise, so a world with the same seed replays identically
+    std::mt19937 random{1};
+    double gaussian(double stddev) { return stddev > 0 ? std::normal_distribution<double>(0, stddev)(random) : 0; }
+
+    uint64_t getTime() const { return now; } // microseconds
+    double getSeconds() const { return now / 1e6; }
+
+    // Advance the clock, stepping every plant and free motor at the physics rate
+    void advanceTo(uint64_t time);
+
+    // Charge virtual CPU time to the running task
+    void charge(uint32_t micros);
+    void chargeRead() { stats.deviceReads++; charge(costs.deviceRead); }
+    void chargeWrite() { stats.deviceWrites++; charge(costs.deviceWrite); }
+
+    // Run program as a task (like the competition template does with autonomous()) until it returns
+    // or timeoutSeconds of virtual time pass. Returns true if the program finished. One that didn't keeps running
+    // in later run() and runFor() calls until it ends or the world is destroyed
+    bool run(std::function<void()> program, double timeoutSeconds, const char* name = "User Program");
+
+    // Let every task run for the given virtual time
+    void runFor(double seconds);
+
+    // Device lookup by smart port (1-21). Creates the device on first use. Returns nullptr and sets errno
+    // if the port is out of range (ENXIO) or already holds another kind of device (ENODEV)
+    SimMotor* getMotor(uint8_t port);
+    SimImu* getImu(uint8_t port);
+    SimGps* getGps(uint8_t port);
+
+    // ADI lookup by port ('A'-'H', 'a'-'h' or 1-8). Returns nullptr and sets errno if out of range
+    SimAdiPort* getAdiPort(uint8_t port);
+
+    std::vector<SimMotor*> getMotors();
+
+    // Plants are not owned by the world and must outlive it or be removed
+    void addPlant(Plant* plant);
+    void removePlant(Plant* plant);
+
+private:
+
+    uint64_t now = 0;
+    uint64_t physicsTime = 0;
+    const uint32_t physicsStep;
+
+    std::array<std::unique_ptr<SmartDevice>, SMART_PORT_COUNT> ports;
+    std::vector<Plant*> plants;
+
+    World* previous;
+
+    template <class T>
+    T* getDevice(uint8_t port, DeviceType type);
+};
+
+} // namespace sim
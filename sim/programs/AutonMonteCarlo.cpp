@@ -0,0 +1,313 @@
+// Runs an autonomous route many times across all host cores with randomized battery voltage, motor
+// strength, traction and IMU noise/scale error, and reports the distribution of completion time and final
+// pose error (against a run without randomization), plus the duration of every step of the route so the
+// steps that dominate it stand out.
+//
+// Usage: AutonMonteCarlo [threeTile|twoTile] [--runs n] [--threads n] [--seed n] [--csv file]
+
+#include "Simulation/World.h"
+#include "Simulation/CataPlant.h"
+#include "Simulation/DrivetrainPlant.h"
+#include "Simulation/FlywheelPlant.h"
+#include "Simulation/Harness.h"
+#include "Subsystems/RobotBuilder.h"
+#include "Programs/Autonomous.h"
+#include "AutonomousFunctions/DriveFunctions.h"
+#include "AutonomousFunctions/PIDPresets.h"
+#include "misc/MathUtility.h"
+#include "misc/ProsUtility.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+
+static constexpr double AUTON_SECONDS = 15;
+static constexpr double TIMEOUT_SECONDS = 60; // let slow runs finish so we see by how much they miss
+
+typedef struct Step {
+    const char* function;
+    int line; // line in the route file
+    double seconds;
+} Step;
+
+// Steps of the run in progress on this thread
+static thread_local std::vector<Step>* currentSteps = nullptr;
+
+template <class F>
+static auto timeStep(const char* function, int line, F call) -> decltype(call()) {
+
+    struct Recorder {
+        const char* function;
+        int line;
+        uint32_t start = pros::millis();
+        ~Recorder() {
+            if (currentSteps) currentSteps->push_back({function, line, (pros::millis() - start) / 1000.0});
+        }
+    } recorder{function, line};
+
+    return call();
+}
+
+// The routes are compiled again here with every blocking call timed. A function-like macro does not expand
+// inside its own expansion, so ::goForwardU still names the real function
+namespace timed {
+
+#define goForwardTimedU(...) timeStep("goForwardTimedU", __LINE__, [&] { return ::goForwardTimedU(__VA_ARGS__); })
+#define goForwardU(...) timeStep("goForwardU", __LINE__, [&] { return ::goForwardU(__VA_ARGS__); })
+#define goTurnU(...) timeStep("goTurnU", __LINE__, [&] { return ::goTurnU(__VA_ARGS__); })
+#define goCurveU(...) timeStep("goCurveU", __LINE__, [&] { return ::goCurveU(__VA_ARGS__); })
+#define shoot(...) timeStep("shoot", __LINE__, [&] { return ::shoot(__VA_ARGS__); })
+#define shootCata(...) timeStep("shootCata", __LINE__, [&] { return ::shootCata(__VA_ARGS__); })
+
+void threeTileAuton(Robot& robot) {
+    #include "../../src/Programs/ThreeTileAuton.txt"
+}
+
+void twoTileAuton(Robot& robot) {
+    #include "../../src/Programs/TwoTileAuton.txt"
+}
+
+#undef goForwardTimedU
+#undef goForwardU
+#undef goTurnU
+#undef goCurveU
+#undef shoot
+#undef shootCata
+
+} // namespace timed
+
+typedef struct Route {
+    const char* name;
+    const char* file;
+    bool isFifteen; // 15" flywheel robot, otherwise the 18" cata robot
+    double startX, startY, startHeading; // inches, degrees, from the route file's header
+    void (*run)(Robot&);
+} Route;
+
+static const Route ROUTES[] = {
+    {"threeTile", "ThreeTileAuton.txt", true, 15.5, 115.0, 0.0, timed::threeTileAuton},
+    {"twoTile", "TwoTileAuton.txt", false, 88.5, 11.0, 180.0, timed::twoTileAuton},
+};
+
+typedef struct Variation {
+    double battery = 12.6; // volts
+    double motorStrength[2][4] = {{1, 1, 1, 1}, {1, 1, 1, 1}}; // left, right
+    double traction = 1;
+    double imuNoise = 0.005; // degrees RMS
+    double imuScale[2] = {1, 1};
+} Variation;
+
+static Variation randomVariation(std::mt19937& random) {
+
+    std::normal_distribution<double> normal(0, 1);
+    std::uniform_real_distribution<double> uniform(0, 1);
+
+    Variation v;
+    v.battery = 11.6 + 1.2 * uniform(random); // sags under load well below its 12.8V resting voltage
+    for (auto& side : v.motorStrength) {
+        for (double& strength : side) strength = clamp(1 + 0.04 * normal(random), 0.85, 1.15);
+    }
+    v.traction = clamp(1 + 0.08 * normal(random), 0.7, 1.3);
+    v.imuNoise = 0.005 + 0.025 * uniform(random);
+    for (double& scale : v.imuScale) scale = 1 + 0.004 * normal(random);
+    return v;
+}
+
+typedef struct Outcome {
+    bool completed = false;
+    bool failed = false; // threw, e.g. both IMUs reported disconnected
+    double seconds = 0;
+    double x = 0, y = 0, heading = 0; // true final pose, inches and radians
+    std::vector<Step> steps;
+    Variation variation;
+} Outcome;
+
+static Outcome runRoute(const Route& route, const Variation& variation, uint32_t seed) {
+
+    sim::World world;
+    world.random.seed(seed);
+    world.batteryVoltage = variation.battery;
+
+    Robot robot = route.isFifteen ? getRobot15(false) : getRobot18(false);
+
+    sim::DrivetrainParameters params = route.isFifteen ? sim::getRobot15Drivetrain() : sim::getRobot18Drivetrain();
+    params.traction *= variation.traction;
+    sim::DrivetrainPlant plant(world, params);
+    plant.setPose(route.startX, route.startY, getRadians(route.startHeading));
+
+    for (int side = 0; side < 2; side++) {
+        const std::vector<int8_t>& ports = side == 0 ? params.leftPorts : params.rightPorts;
+        for (size_t i = 0; i < ports.size() && i < 4; i++) {
+            world.getMotor(abs(ports[i]))->strength = variation.motorStrength[side][i];
+        }
+    }
+    for (size_t i = 0; i < params.imuPorts.size() && i < 2; i++) {
+        sim::SimImu* imu = world.getImu(params.imuPorts[i]);
+        imu->noise = variation.imuNoise;
+        imu->scale = variation.imuScale[i];
+    }
+
+    std::unique_ptr<sim::FlywheelPlant> flywheel;
+    std::unique_ptr<sim::CataPlant> cata;
+    if (robot.flywheel) flywheel.reset(new sim::FlywheelPlant(world, sim::getRobot15Flywheel(robot.flywheel->getVoltRpmData())));
+    if (robot.cata) cata.reset(new sim::CataPlant(world, sim::getRobot18Cata()));
+
+    pros::lcd::initialize();
+    world.run([&] { robot.localizer->init(); }, 10, "Initialize");
+
+    Outcome outcome;
+    outcome.variation = variation;
+    currentSteps = &outcome.steps;
+
+    double start = world.getSeconds();
+    outcome.completed = world.run([&] {
+
+        // Same tasks as autonomous() in main.cpp
+        scheduleLocalizer(robot);
+        scheduleFlywheel(robot);
+
+        try {
+            route.run(robot);
+        } catch (std::runtime_error& e) {
+            outcome.failed = true;
+            robot.drive->stop();
+        }
+    }, TIMEOUT_SECONDS, "Autonomous");
+
+    currentSteps = nullptr;
+    outcome.seconds = world.getSeconds() - start;
+    outcome.x = plant.getX();
+    outcome.y = plant.getY();
+    outcome.heading = plant.getHeading();
+    return outcome;
+}
+
+static double percentile(std::vector<double> values, double p) {
+    if (values.empty()) return 0;
+    std::sort(values.begin(), values.end());
+    size_t index = std::min(values.size() - 1, (size_t) (p * (values.size() - 1) + 0.5));
+    return values[index];
+}
+
+static void printDistribution(const char* name, const std::vector<double>& values, const char* unit) {
+    double mean = 0;
+    for (double v : values) mean += v / values.size();
+    printf("%-22s mean %7.2f  p5 %7.2f  p50 %7.2f  p95 %7.2f  max %7.2f %s\n", name, mean,
+        percentile(values, 0.05), percentile(values, 0.5), percentile(values, 0.95), percentile(values, 1), unit);
+}
+
+int main(int argc, char** argv) {
+
+    const Route* route = &ROUTES[0];
+    int runs = 200;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    uint32_t seed = 1;
+    const char* csvPath = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (!strcmp(argv[i], "--runs") && hasValue) runs = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--threads") && hasValue) threads = std::max(1, atoi(argv[++i]));
+        else if (!strcmp(argv[i], "--seed") && hasValue) seed = strtoul(argv[++i], nullptr, 10);
+        else if (!strcmp(argv[i], "--csv") && hasValue) csvPath = argv[++i];
+        else {
+            route = nullptr;
+            for (const Route& r : ROUTES) if (!strcmp(argv[i], r.name)) route = &r;
+            if (!route) {
+                fprintf(stderr, "Usage: %s [threeTile|twoTile] [--runs n] [--threads n] [--seed n] [--csv file]\n",
+                    argv[0]);
+                return 1;
+            }
+        }
+    }
+
+    auto wallStart = std::chrono::steady_clock::now();
+
+    // The drive functions print every tick; the report goes to stdout after the runs
+    int savedStdout = sim::silenceStdout();
+
+    Outcome nominal = runRoute(*route, Variation(), seed);
+
+    std::vector<Outcome> outcomes(runs);
+    std::atomic<int> next(0);
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; t++) {
+        workers.emplace_back([&] {
+            for (int i = next++; i < runs; i = next++) {
+                std::mt19937 random(seed * 7919 + i + 1);
+                outcomes[i] = runRoute(*route, randomVariation(random), seed + i + 1);
+            }
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+
+    sim::restoreStdout(savedStdout);
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+    std::vector<double> times, positionErrors, headingErrors;
+    int completed = 0, failed = 0, overTime = 0;
+    for (const Outcome& o : outcomes) {
+        if (o.completed) completed++;
+        if (o.failed) failed++;
+        if (!o.completed || o.seconds > AUTON_SECONDS) overTime++;
+        times.push_back(o.seconds);
+        positionErrors.push_back(hypot(o.x - nominal.x, o.y - nominal.y));
+        headingErrors.push_back(fabs(getDegrees(deltaInHeading(o.heading, nominal.heading))));
+    }
+
+    printf("%s (%s): %d runs on %u threads in %.2f s wall time\n", route->name, route->file, runs, threads,
+        wallSeconds);
+    printf("Nominal run: %.2f s, final pose (%.1f, %.1f) %.1f deg\n", nominal.seconds, nominal.x, nominal.y,
+        getDegrees(nominal.heading));
+    printf("Finished %d, threw %d, over %.0f s: %d (%.1f%%)\n\n", completed, failed, AUTON_SECONDS, overTime,
+        100.0 * overTime / std::max(1, runs));
+
+    printDistribution("completion time", times, "s");
+    printDistribution("final position error", positionErrors, "in");
+    printDistribution("final heading error", headingErrors, "deg");
+
+    // Steps line up across runs as long as the route has no branches, which generated routes never do
+    printf("\n%5s  %-16s %8s %8s %8s %8s\n", "line", "step", "nominal", "mean", "p95", "share");
+    double stepTotal = 0;
+    std::vector<std::vector<double>> stepTimes(nominal.steps.size());
+    for (const Outcome& o : outcomes) {
+        for (size_t i = 0; i < o.steps.size() && i < stepTimes.size(); i++) {
+            if (o.steps[i].line == nominal.steps[i].line) stepTimes[i].push_back(o.steps[i].seconds);
+        }
+    }
+    std::vector<double> means(stepTimes.size());
+    for (size_t i = 0; i < stepTimes.size(); i++) {
+        for (double t : stepTimes[i]) means[i] += t / stepTimes[i].size();
+        stepTotal += means[i];
+    }
+    double meanTime = 0;
+    for (double t : times) meanTime += t / times.size();
+
+    for (size_t i = 0; i < stepTimes.size(); i++) {
+        printf("%5d  %-16s %8.2f %8.2f %8.2f %7.1f%%\n", nominal.steps[i].line, nominal.steps[i].function,
+            nominal.steps[i].seconds, means[i], percentile(stepTimes[i], 0.95), 100 * means[i] / meanTime);
+    }
+    printf("%5s  %-16s %8s %8.2f %8s %7.1f%%\n", "", "other", "", meanTime - stepTotal, "",
+        100 * (meanTime - stepTotal) / meanTime);
+
+    if (csvPath) {
+        FILE* csv = fopen(csvPath, "w");
+        if (!csv) {
+            perror(csvPath);
+            return 1;
+        }
+        fprintf(csv, "run,completed,seconds,position_error_in,heading_error_deg,battery_v,traction,imu_noise_deg\n");
+        for (int i = 0; i < runs; i++) {
+            const Outcome& o = outcomes[i];
+            fprintf(csv, "%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.4f\n", i, o.completed, o.seconds, positionErrors[i],
+                headingErrors[i], o.variation.battery, o.variation.traction, o.variation.imuNoise);
+        }
+        fclose(csv);
+    }
+
+    return 0;
+}
@@ -0,0 +1,163 @@
+// Converts path generator output into a binary path file (see PathFollowing/PathFile.h) for PathFollower::loadPath()
+// to read off the SD card, one input file per segment in the order given. Inputs are CSV or whitespace separated:
+//
+//   - squiggles serialize_path() output: a header row naming the columns (x and y are used)
+//   - PathGen style rows with no header, of which the first two columns are x and y
+//
+// Only positions are kept; PathFollower works out headings and curvature when it indexes the segment. squiggles
+// works in meters, so pass --meters to convert it to inches. Loads the written file back and reports the load time.
+//
+// Usage: ConvertPath [--meters] output.bin segment.csv...
+
+#include "PathFollowing/PathFile.h"
+#include "misc/MathUtility.h"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+enum Column { COLUMN_X, COLUMN_Y, COLUMNS };
+
+static std::vector<std::string> split(const std::string& line) {
+    std::vector<std::string> fields;
+    std::string field;
+    for (char c : line) {
+        if (c == ',' || c == ' ' || c == '\t' || c == '\r') {
+            if (!field.empty()) fields.push_back(field);
+            field.clear();
+        } else field += c;
+    }
+    if (!field.empty()) fields.push_back(field);
+    return fields;
+}
+
+static bool isNumber(const std::string& field) {
+    char* end;
+    strtod(field.c_str(), &end);
+    return end != field.c_str() && *end == 0;
+}
+
+// Which input column holds each Column, -1 if none
+static void readHeader(const std::vector<std::string>& names, int columns[COLUMNS]) {
+    static const char* NAMES[COLUMNS] = {"x", "y"};
+    for (int c = 0; c < COLUMNS; c++) {
+        columns[c] = -1;
+        for (int i = 0; i < (int) names.size(); i++) {
+            if (names[i] == NAMES[c]) columns[c] = i;
+        }
+    }
+}
+
+static bool readSegment(const char* path, bool meters, std::vector<PathFilePoint>& points) {
+
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        perror(path);
+        return false;
+    }
+
+    int columns[COLUMNS] = {COLUMN_X, COLUMN_Y};
+    bool first = true;
+    char buffer[1024];
+    int lineNumber = 0;
+    while (fgets(buffer, sizeof(buffer), file)) {
+        lineNumber++;
+        std::vector<std::string> fields = split(std::string(buffer, strcspn(buffer, "\n")));
+        if (fields.empty() || fields[0][0] == '#') continue;
+
+        if (first && !isNumber(fields[0])) {
+            readHeader(fields, columns);
+            if (columns[COLUMN_X] < 0 || columns[COLUMN_Y] < 0) {
+                fprintf(stderr, "%s: header has no x and y columns\n", path);
+                fclose(file);
+                return false;
+            }
+            first = false;
+            continue;
+        }
+        first = false;
+
+        double values[COLUMNS] = {};
+        bool has[COLUMNS] = {};
+        for (int c = 0; c < COLUMNS; c++) {
+            int i = columns[c];
+            if (i < 0 || i >= (int) fields.size()) continue;
+            if (!isNumber(fields[i])) {
+                fprintf(stderr, "%s:%d: '%s' is not a number\n", path, lineNumber, fields[i].c_str());
+                fclose(file);
+                return false;
+            }
+            values[c] = atof(fields[i].c_str());
+            has[c] = true;
+        }
+        if (!has[COLUMN_X] || !has[COLUMN_Y]) {
+            fprintf(stderr, "%s:%d: needs at least x and y\n", path, lineNumber);
+            fclose(file);
+            return false;
+        }
+
+        double scale = meters ? METERS_TO_INCHES : 1;
+        points.push_back({(float) (values[COLUMN_X] * scale), (float) (values[COLUMN_Y] * scale)});
+    }
+    fclose(file);
+
+    if (points.empty()) {
+        fprintf(stderr, "%s: no points\n", path);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+
+    bool meters = false;
+    int arg = 1;
+    if (arg < argc && !strcmp(argv[arg], "--meters")) {
+        meters = true;
+        arg++;
+    }
+    if (argc - arg < 2) {
+        fprintf(stderr, "Usage: %s [--meters] output.bin segment.csv...\n", argv[0]);
+        return 1;
+    }
+    const char* outputPath = argv[arg++];
+
+    std::vector<std::vector<PathFilePoint>> segments;
+    for (; arg < argc; arg++) {
+        segments.emplace_back();
+        if (!readSegment(argv[arg], meters, segments.back())) return 1;
+    }
+
+    std::vector<uint8_t> bytes = PathFile::encode(segments);
+    FILE* output = fopen(outputPath, "wb");
+    if (!output || fwrite(bytes.data(), 1, bytes.size(), output) != bytes.size()) {
+        perror(outputPath);
+        return 1;
+    }
+    fclose(output);
+
+    // Read it back the way the robot does
+    PathFile file;
+    auto start = std::chrono::steady_clock::now();
+    bool loaded = file.load(outputPath);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (!loaded) {
+        fprintf(stderr, "%s: wrote a file that doesn't load back\n", outputPath);
+        return 1;
+    }
+
+    printf("%s: %d segments, %u points, %zu bytes, loaded in %.3f ms\n", outputPath, file.getSegmentCount(),
+        file.getPointCount(), bytes.size(), seconds * 1000);
+    for (int i = 0; i < file.getSegmentCount(); i++) {
+        PathSegmentView segment = file.getSegment(i);
+        double length = 0;
+        for (uint32_t p = 1; p < segment.count; p++) {
+            length += getDistance(segment.x[p - 1], segment.y[p - 1], segment.x[p], segment.y[p]);
+        }
+        printf("  %d: %u points, %.1f in, (%.1f, %.1f) to (%.1f, %.1f)\n", i, segment.count, length, segment.x[0],
+            segment.y[0], segment.x[segment.count - 1], segment.y[segment.count - 1]);
+    }
+    return 0;
+}
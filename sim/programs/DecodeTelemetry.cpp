@@ -0,0 +1,88 @@
+// Decodes a binary telemetry log (see misc/TelemetryFormat.h) written to the SD card, serial or by a sim program
+// into one CSV per channel, columns named from the log's own header: prefix_<channel>.csv with time_s followed by
+// the channel's fields. Prints a record count and size summary per channel.
+//
+// Usage: DecodeTelemetry log.bin [output prefix]
+
+#include "misc/TelemetryFormat.h"
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv) {
+
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "Usage: %s log.bin [output prefix]\n", argv[0]);
+        return 1;
+    }
+    std::string prefix = argc == 3 ? argv[2] : std::string(argv[1]).substr(0, std::string(argv[1]).rfind('.'));
+
+    FILE* input = fopen(argv[1], "rb");
+    if (!input) {
+        perror(argv[1]);
+        return 1;
+    }
+    std::vector<uint8_t> log;
+    uint8_t chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), input)) > 0) log.insert(log.end(), chunk, chunk + n);
+    fclose(input);
+
+    TelemetryDecoder decoder;
+    int offset = decoder.readHeader(log.data(), log.size());
+    if (offset <= 0) {
+        fprintf(stderr, "%s: %s\n", argv[1], offset < 0 ? "not a telemetry log" : "header is incomplete");
+        return 1;
+    }
+
+    FILE* outputs[TELEMETRY_MAX_CHANNELS] = {};
+    uint32_t records[TELEMETRY_MAX_CHANNELS] = {};
+    uint64_t bytes[TELEMETRY_MAX_CHANNELS] = {};
+
+    bool corrupt = false;
+    while (offset < (int) log.size()) {
+
+        uint8_t id;
+        uint32_t time;
+        double values[TelemetryRecord::MAX_VALUES];
+        int read = decoder.decode(log.data() + offset, log.size() - offset, id, time, values);
+        if (read <= 0) {
+            // A log cut off mid-record (e.g. power loss) still decodes up to there
+            if (read < 0) corrupt = true;
+            break;
+        }
+        offset += read;
+
+        const TelemetryDecoder::Channel& channel = decoder.getChannel(id);
+        if (!outputs[id]) {
+            std::string path = prefix + "_" + channel.name + ".csv";
+            if (!(outputs[id] = fopen(path.c_str(), "w"))) {
+                perror(path.c_str());
+                return 1;
+            }
+            fprintf(outputs[id], "time_s");
+            for (int i = 0; i < channel.count; i++) fprintf(outputs[id], ",%s", channel.fields[i]);
+            fprintf(outputs[id], "\n");
+        }
+
+        fprintf(outputs[id], "%.6f", time / 1e6);
+        for (int i = 0; i < channel.count; i++) fprintf(outputs[id], ",%.*f", channel.scales[i] >= 1000 ? 4 : 2, values[i]);
+        fprintf(outputs[id], "\n");
+
+        records[id]++;
+        bytes[id] += read;
+    }
+
+    for (int id = 0; id < TELEMETRY_MAX_CHANNELS; id++) {
+        if (!outputs[id]) continue;
+        fclose(outputs[id]);
+        printf("%-10s %7u records, %5.1f bytes/record -> %s_%s.csv\n", decoder.getChannel(id).name, records[id],
+            (double) bytes[id] / records[id], prefix.c_str(), decoder.getChannel(id).name);
+    }
+    if (offset < (int) log.size()) {
+        fprintf(stderr, "%s: stopped at byte %d of %zu (%s)\n", argv[1], offset, log.size(),
+            corrupt ? "corrupt record" : "log ends mid-record");
+    }
+
+    return corrupt ? 1 : 0;
+}
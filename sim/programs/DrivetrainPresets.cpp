@@ -0,0 +1,103 @@
+// Runs goForwardU, goTurnU and goCurveU with the PID presets from the autonomous routes on a simulated
+// 15" drivetrain and reports settle time, overshoot and final error for each
+
+#include "Simulation/World.h"
+#include "Simulation/DrivetrainPlant.h"
+#include "Simulation/Harness.h"
+#include "Subsystems/RobotBuilder.h"
+#include "AutonomousFunctions/DriveFunctions.h"
+#include "AutonomousFunctions/PIDPresets.h"
+#include <chrono>
+#include <functional>
+#include <stdio.h>
+
+typedef struct Trial {
+    const char* function;
+    const char* preset;
+    double target; // inches of travel or degrees of heading change
+    bool isTurn;
+    std::function<void(Robot&)> run;
+} Trial;
+
+static void runTrial(const Trial& trial) {
+
+    sim::World world;
+    Robot robot = getRobot15(false);
+    sim::DrivetrainPlant plant(world, sim::getRobot15Drivetrain());
+
+    pros::lcd::initialize();
+    world.run([&] {
+        robot.localizer->init();
+        robot.drive->setBrakeMode(pros::E_MOTOR_BRAKE_BRAKE);
+    }, 10, "Initialize");
+
+    double startX = plant.getX(), startY = plant.getY(), startHeading = plant.getHeading();
+    double direction = trial.target < 0 ? -1 : 1;
+
+    // Progress towards the target, in the target's units, signed so that overshoot is positive
+    auto measure = [&] {
+        if (trial.isTurn) return direction * getDegrees(plant.getHeading() - startHeading);
+        double dx = plant.getX() - startX, dy = plant.getY() - startY;
+        return direction * (dx * cos(startHeading) + dy * sin(startHeading));
+    };
+
+    double peak = -1e9;
+    sim::StepProbe probe(world, [&] { peak = fmax(peak, measure()); });
+
+    double start = world.getSeconds();
+    int saved = sim::silenceStdout();
+    bool finished = world.run([&] { trial.run(robot); }, 10);
+    sim::restoreStdout(saved);
+    double settle = world.getSeconds() - start;
+
+    double errorAtExit = fabs(trial.target) - measure();
+    world.runFor(0.5);
+    double errorAtRest = fabs(trial.target) - measure();
+
+    double overshoot = fmax(0, peak - fabs(trial.target));
+    printf("%-10s %-22s %8.1f  %s %7.3f  %9.2f  %10.2f  %10.2f\n", trial.function, trial.preset, trial.target,
+        finished ? " " : "*", settle, overshoot, errorAtExit, errorAtRest);
+}
+
+int main() {
+
+    std::vector<Trial> forwards;
+    for (double distance : {6.0, 12.0, 24.0, 48.0, -24.0}) {
+        forwards.push_back({"goForwardU", "GFU_DIST_PRECISE(0.8)", distance, false, [=](Robot& robot) {
+            goForwardU(robot, GFU_DIST_PRECISE(0.8), GFU_TURN, distance, 0);
+        }});
+    }
+    for (double distance : {24.0, 48.0}) {
+        forwards.push_back({"goForwardU", "GFU_DIST_FAST(1)", distance, false, [=](Robot& robot) {
+            goForwardU(robot, GFU_DIST_FAST(1), GFU_TURN, distance, 0);
+        }});
+    }
+    for (double radius : {24.0, -24.0}) {
+        forwards.push_back({"goCurveU", radius > 0 ? "GCU_CURVE r=24" : "GCU_CURVE r=-24", 90, true, [=](Robot& robot) {
+            goCurveU(robot, GFU_DIST_PRECISE(0.8), GCU_CURVE, 0, getRadians(90), radius);
+        }});
+    }
+
+    std::vector<Trial> turns;
+    for (double degrees : {15.0, 45.0, 90.0, 180.0, -90.0}) {
+        turns.push_back({"goTurnU", "GTU_TURN", degrees, true, [=](Robot& robot) {
+            goTurnU(robot, GTU_TURN, getRadians(degrees));
+        }});
+        turns.push_back({"goTurnU", "GTU_TURN_PRECISE", degrees, true, [=](Robot& robot) {
+            goTurnU(robot, GTU_TURN_PRECISE, getRadians(degrees));
+        }});
+    }
+
+    auto wallStart = std::chrono::steady_clock::now();
+
+    printf("%-10s %-22s %8s  %9s  %9s  %10s  %10s\n", "function", "preset", "target", "settle(s)", "overshoot",
+        "exit error", "rest error");
+    printf("goForwardU in inches, goCurveU and goTurnU in degrees of heading change\n");
+    for (const Trial& trial : forwards) runTrial(trial);
+    for (const Trial& trial : turns) runTrial(trial);
+
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    printf("* = did not settle within 10 s. Wall time: %.2f s\n", wallSeconds);
+
+    return 0;
+}
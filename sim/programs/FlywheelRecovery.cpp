@@ -0,0 +1,182 @@
+// Runs the 15" robot's take-back-half flywheel controller on a simulated flywheel fitted to its volt -> rpm
+// table and reports spin-up time, steady state ripple and how quickly the wheel recovers after each disc,
+// which bounds how fast shoot() could feed discs back-to-back.
+//
+// Usage: FlywheelRecovery [gain ...]    (default: 0.25x to 4x the gain in getRobot15)
+
+#include "Simulation/World.h"
+#include "Simulation/FlywheelPlant.h"
+#include "Subsystems/RobotBuilder.h"
+#include "Subsystems/Flywheel/TBHFlywheel.h"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+static constexpr double ROBOT15_GAIN = 0.00005;
+static constexpr int SHOTS = 3;
+static constexpr uint32_t TIMEOUT_MS = 5000; // same spin-up timeout as shoot()
+static constexpr uint32_t SETTLE_MS = 250;
+
+typedef struct Result {
+    double spinUp = -1; // seconds to the first atTargetVelocity(), -1 if it never got there
+    double settle = -1; // seconds until the true velocity stayed within 20rpm for SETTLE_MS
+    double rippleStd = 0, ripplePeakToPeak = 0; // rpm of the true velocity once settled
+    double drop[SHOTS] = {}; // rpm below target at the bottom of each sag
+    double recovery[SHOTS] = {}; // seconds from launch until atTargetVelocity() again, -1 on timeout
+    double rearm[SHOTS] = {}; // seconds from launch until Shooter's rearm condition (velocity above target)
+    double exitVelocity[SHOTS] = {}; // m/s
+} Result;
+
+// Wait until condition() is true, polling every millisecond. Returns seconds waited or -1 on timeout
+template <class F>
+static double waitFor(F condition, uint32_t timeoutMs) {
+    uint32_t start = pros::millis();
+    while (!condition()) {
+        if (pros::millis() - start >= timeoutMs) return -1;
+        pros::delay(1);
+    }
+    return (pros::millis() - start) / 1000.0;
+}
+
+static Result runTrial(double gain, double target) {
+
+    sim::World world;
+    Robot robot = getRobot15(false);
+    std::vector<DataPoint> voltRpm = robot.flywheel->getVoltRpmData();
+    robot.flywheel.reset();
+
+    sim::FlywheelPlant plant(world, sim::getRobot15Flywheel(voltRpm));
+    TBHFlywheel flywheel({-4, 8}, voltRpm, {}, {}, 0, gain);
+
+    Result result;
+    world.run([&] {
+
+        pros::Task controller([&] { flywheel.maintainVelocityTask(); }, "Flywheel");
+        flywheel.setVelocity(target);
+
+        result.spinUp = waitFor([&] { return flywheel.atTargetVelocity(); }, TIMEOUT_MS);
+        if (result.spinUp < 0) return;
+
+        // Settled once the true velocity stays in the band for SETTLE_MS. The readings are noisy enough
+        // that atTargetVelocity() alone flickers in and out
+        uint32_t start = pros::millis() - (uint32_t) (result.spinUp * 1000);
+        uint32_t inBandSince = pros::millis();
+        while (pros::millis() - inBandSince < SETTLE_MS) {
+            if (pros::millis() - start > 2 * TIMEOUT_MS) return;
+            if (fabs(plant.getVelocity() - target) >= 20) inBandSince = pros::millis();
+            pros::delay(1);
+        }
+        result.settle = (pros::millis() - start) / 1000.0;
+
+        double sum = 0, sumSquares = 0, low = 1e9, high = -1e9;
+        constexpr int SAMPLES = 1000;
+        for (int i = 0; i < SAMPLES; i++) {
+            double velocity = plant.getVelocity();
+            sum += velocity;
+            sumSquares += velocity * velocity;
+            low = fmin(low, velocity);
+            high = fmax(high, velocity);
+            pros::delay(1);
+        }
+        double mean = sum / SAMPLES;
+        result.rippleStd = sqrt(fmax(0, sumSquares / SAMPLES - mean * mean));
+        result.ripplePeakToPeak = high - low;
+
+        // Feed the next disc as soon as the controller reports it is back at speed, like shoot() does
+        for (int shot = 0; shot < SHOTS; shot++) {
+            plant.launchDisc();
+            uint32_t launch = pros::millis();
+            double lowest = plant.getVelocity();
+
+            bool dropped = false;
+            result.recovery[shot] = result.rearm[shot] = -1;
+            while (pros::millis() - launch < TIMEOUT_MS && (result.recovery[shot] < 0 || result.rearm[shot] < 0)) {
+                pros::delay(1);
+                lowest = fmin(lowest, plant.getVelocity());
+                double elapsed = (pros::millis() - launch) / 1000.0;
+
+                if (!flywheel.atTargetVelocity()) dropped = true;
+                else if (dropped && !plant.isLaunching() && result.recovery[shot] < 0) result.recovery[shot] = elapsed;
+
+                if (dropped && flywheel.getCurrentVelocity() > target && result.rearm[shot] < 0) {
+                    result.rearm[shot] = elapsed;
+                }
+            }
+            result.drop[shot] = target - lowest;
+            result.exitVelocity[shot] = plant.getLastExitVelocity();
+        }
+    }, 30);
+
+    return result;
+}
+
+// Open loop check of the fitted plant against the table it was fitted to
+static void printFit() {
+
+    sim::World world;
+    Robot robot = getRobot15(false);
+    std::vector<DataPoint> voltRpm = robot.flywheel->getVoltRpmData();
+    sim::FlywheelParameters params = sim::getRobot15Flywheel(voltRpm);
+    sim::FlywheelPlant plant(world, params);
+
+    printf("Plant fitted to getRobot15 volt -> rpm table: free speed x%.3f, friction %.4f Nm\n",
+        params.freeSpeedScale, params.frictionTorque);
+    printf("%6s %10s %10s\n", "volts", "table rpm", "plant rpm");
+    for (const DataPoint& point : voltRpm) {
+        world.run([&] { robot.flywheel->setRawVoltage(point.volt); }, 1);
+        world.runFor(3);
+        printf("%6.1f %10.0f %10.0f\n", point.volt, point.rpm, plant.getVelocity());
+    }
+    printf("\n");
+}
+
+int main(int argc, char** argv) {
+
+    std::vector<double> gains;
+    for (int i = 1; i < argc; i++) {
+        char* end;
+        double gain = strtod(argv[i], &end);
+        if (end == argv[i] || *end != '\0') {
+            fprintf(stderr, "Usage: %s [gain ...]\n", argv[0]);
+            return 1;
+        }
+        gains.push_back(gain);
+    }
+    if (gains.empty()) {
+        for (double scale : {0.25, 0.5, 1.0, 2.0, 4.0}) gains.push_back(ROBOT15_GAIN * scale);
+    }
+
+    auto wallStart = std::chrono::steady_clock::now();
+
+    printFit();
+
+    printf("%-9s %6s  %7s %7s  %6s %6s  %-20s %-20s %-20s %s\n", "gain", "target", "spinup", "settle", "std",
+        "p-p", "drop (rpm)", "back in band (ms)", "rearm (ms)", "exit m/s");
+
+    for (double gain : gains) {
+        for (double target : {2450.0, 2800.0, 3350.0}) {
+
+            Result r = runTrial(gain, target);
+            if (r.settle < 0) {
+                printf("%-9.6f %6.0f  %7s\n", gain, target, r.spinUp < 0 ? "timeout" : "unsettled");
+                continue;
+            }
+
+            char drop[64], recovery[64], rearm[64];
+            snprintf(drop, sizeof(drop), "%.0f/%.0f/%.0f", r.drop[0], r.drop[1], r.drop[2]);
+            snprintf(recovery, sizeof(recovery), "%.0f/%.0f/%.0f", r.recovery[0] * 1000, r.recovery[1] * 1000,
+                r.recovery[2] * 1000);
+            snprintf(rearm, sizeof(rearm), "%.0f/%.0f/%.0f", r.rearm[0] * 1000, r.rearm[1] * 1000, r.rearm[2] * 1000);
+
+            printf("%-9.6f %6.0f  %7.2f %7.2f  %6.1f %6.1f  %-20s %-20s %-20s %.2f/%.2f/%.2f\n", gain, target,
+                r.spinUp, r.settle, r.rippleStd, r.ripplePeakToPeak, drop, recovery, rearm,
+                r.exitVelocity[0], r.exitVelocity[1], r.exitVelocity[2]);
+        }
+    }
+
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    printf("Times per shot for %d back-to-back discs; -1 = not within %u ms. Wall time: %.2f s\n", SHOTS,
+        TIMEOUT_MS, wallSeconds);
+
+    return 0;
+}
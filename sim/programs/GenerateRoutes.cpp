@@ -0,0 +1,59 @@
+// Generates the trajectories of the routes in PathFollowing/RouteSpecs.h and writes them as constant tables to a
+// source file, src/PathFollowing/RouteTables.cpp when run by the build (see firmware/routes.mk), with the same
+// generateRoute() PathCache runs on the robot. Prints each route's length.
+//
+// Usage: GenerateRoutes output.cpp
+
+#include "PathFollowing/RouteGenerator.h"
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+
+int main(int argc, char** argv) {
+
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s output.cpp\n", argv[0]);
+        return 1;
+    }
+    FILE* output = fopen(argv[1], "w");
+    if (!output) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    fprintf(output, "// Generated by sim/programs/GenerateRoutes from include/PathFollowing/RouteSpecs.h. Do not edit\n\n");
+    fprintf(output, "#include \"PathFollowing/Routes.h\"\n");
+
+    std::vector<int> counts;
+    for (int r = 0; r < ROUTE_SPEC_COUNT; r++) {
+        const RouteSpec& spec = ROUTE_SPECS[r];
+        std::vector<PathPoint> points;
+        if (!generateRoute(spec, points)) {
+            fprintf(stderr, "%s: needs 2 to %d distinct poses\n", spec.name, RouteSpec::MAX_POSES);
+            fclose(output);
+            remove(argv[1]);
+            return 1;
+        }
+
+        double length = points.back().s;
+        counts.push_back(points.size());
+        printf("%-20s %4d points %8.1f in\n", spec.name, (int) points.size(), length);
+
+        fprintf(output, "\n// %s: %.1f in\n", spec.name, length);
+        fprintf(output, "static constexpr PathPoint ROUTE_%d_POINTS[] = {\n", r);
+        for (const PathPoint& p : points) {
+            fprintf(output, "    {%.10g, %.10g, %.10g, %.10g, %.10g, %.10g, %.10g},\n", p.x, p.y, p.s, p.tangentX,
+                p.tangentY, p.length, p.curvature);
+        }
+        fprintf(output, "};\n");
+    }
+
+    fprintf(output, "\nconst Route ROUTES[] = {\n");
+    for (int r = 0; r < ROUTE_SPEC_COUNT; r++) {
+        fprintf(output, "    {\"%s\", ROUTE_%d_POINTS, %d, 0x%08x},\n", ROUTE_SPECS[r].name, r, counts[r],
+            (unsigned) getRouteHash(ROUTE_SPECS[r]));
+    }
+    fprintf(output, "};\n\nconst int ROUTE_COUNT = %d;\n", ROUTE_SPEC_COUNT);
+    fclose(output);
+    return 0;
+}
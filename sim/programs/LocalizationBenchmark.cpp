@@ -0,0 +1,238 @@
+// Compares PoseEKF, the filter Odometry runs, with the older fixed-gain OdometryFilter on simulated sensor data
+// with a known true pose. Each run drives a random sequence of arcs and straights, and generates what the robot
+// would read at 100 Hz: encoders with scale error and slip, two IMUs with their own drift, and a 50 Hz GPS with
+// noise, latency, occasional outliers and dropouts it reports through its error. PoseEKF runs both with its latency
+// compensation and with every GPS reading fused as if it were current. All filters see the same readings; reports
+// their position and heading error against the truth and the host CPU time of an update.
+//
+// Usage: LocalizationBenchmark [--runs n] [--seconds s] [--gps-latency s] [--seed n]
+
+#include "Simulation/OdometryFilter.h"
+#include "Subsystems/Localizer/PoseEKF.h"
+#include "misc/MathUtility.h"
+#include <chrono>
+#include <math.h>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+static const double TRACK_WIDTH = 12; // inches
+static const double SENSOR_PERIOD = 0.01; // seconds
+static const int TRUTH_STEPS = 10; // truth integration steps per sensor period
+static const double GPS_PERIOD = 0.02;
+
+typedef struct Truth {
+    double x, y, heading;
+} Truth;
+
+typedef struct Run {
+    std::vector<SensorSnapshot> snapshots;
+    std::vector<Truth> truth;
+} Run;
+
+typedef struct Errors {
+    uint64_t count = 0;
+    double positionSquared = 0, headingSquared = 0, positionMax = 0;
+    double seconds = 0; // CPU time in update()
+
+    void add(double x, double y, double heading, const Truth& truth) {
+        double distance = getDistance(x, y, truth.x, truth.y);
+        double headingError = deltaInHeading(heading, truth.heading);
+        positionSquared += distance * distance;
+        headingSquared += headingError * headingError;
+        positionMax = fmax(positionMax, distance);
+        count++;
+    }
+    void merge(const Errors& other) {
+        count += other.count;
+        positionSquared += other.positionSquared;
+        headingSquared += other.headingSquared;
+        positionMax = fmax(positionMax, other.positionMax);
+        seconds += other.seconds;
+    }
+    double getPositionRms() const { return count ? sqrt(positionSquared / count) : 0; }
+    double getHeadingRms() const { return count ? sqrt(headingSquared / count) : 0; }
+} Errors;
+
+static double wrap(double heading) {
+    heading = fmod(heading, 2 * M_PI);
+    return heading < 0 ? heading + 2 * M_PI : heading;
+}
+
+static Run generate(std::mt19937& rng, double seconds, double gpsLatency) {
+
+    std::normal_distribution<double> normal(0, 1);
+    std::uniform_real_distribution<double> uniform(0, 1);
+
+    Run run;
+    Truth truth = {uniform(rng) * 96 - 48, uniform(rng) * 96 - 48, uniform(rng) * 2 * M_PI};
+    const Truth start = truth;
+    double startHeading = truth.heading; // the IMUs are set to the field heading before starting
+    double velocity = 0, turnRate = 0, targetVelocity = 0, targetTurnRate = 0, segmentLeft = 0;
+
+    // Per run sensor errors
+    double scaleLeft = 1 + 0.01 * normal(rng), scaleRight = 1 + 0.01 * normal(rng);
+    double biasA = getRadians(0.2) * normal(rng), biasB = getRadians(0.2) * normal(rng);
+    double imuScaleA = 1 + 0.003 * normal(rng), imuScaleB = 1 + 0.003 * normal(rng);
+
+    double left = 0, right = 0;
+    double driftA = 0, driftB = 0, turnedA = 0, turnedB = 0;
+    double gpsX = 0, gpsY = 0, gpsHeading = 0, gpsError = 0.01, nextGps = 0, dropoutLeft = 0;
+    int gpsLagTicks = (int) lround(gpsLatency / SENSOR_PERIOD);
+
+    for (double t = 0; t < seconds; t += SENSOR_PERIOD) {
+
+        if (segmentLeft <= 0) {
+            segmentLeft = 0.5 + 2 * uniform(rng);
+            targetVelocity = uniform(rng) * 120 - 50;
+            targetTurnRate = uniform(rng) < 0.3 ? 0 : uniform(rng) * 8 - 4;
+        }
+        segmentLeft -= SENSOR_PERIOD;
+
+        // Drive, with the drivetrain lagging the targets
+        double dt = SENSOR_PERIOD / TRUTH_STEPS;
+        double travelLeft = 0, travelRight = 0, turn = 0;
+        for (int i = 0; i < TRUTH_STEPS; i++) {
+            velocity += (targetVelocity - velocity) * dt / 0.15;
+            turnRate += (targetTurnRate - turnRate) * dt / 0.15;
+            truth.x += velocity * dt * cos(truth.heading + turnRate * dt / 2);
+            truth.y += velocity * dt * sin(truth.heading + turnRate * dt / 2);
+            truth.heading += turnRate * dt;
+            travelLeft += (velocity - turnRate * TRACK_WIDTH / 2) * dt;
+            travelRight += (velocity + turnRate * TRACK_WIDTH / 2) * dt;
+            turn += turnRate * dt;
+        }
+        truth.heading = wrap(truth.heading);
+
+        // Wheels slip more the harder the robot accelerates
+        double slip = 0.01 + 0.03 * fabs(targetVelocity - velocity) / 100;
+        left += travelLeft * scaleLeft * (1 + slip * normal(rng));
+        right += travelRight * scaleRight * (1 + slip * normal(rng));
+
+        driftA += biasA * SENSOR_PERIOD;
+        driftB += biasB * SENSOR_PERIOD;
+        turnedA += turn * imuScaleA;
+        turnedB += turn * imuScaleB;
+
+        SensorSnapshot snapshot;
+        snapshot.time = (uint64_t) llround(t * 1000000);
+        snapshot.groups = SENSE_ALL;
+        snapshot.leftPosition = left;
+        snapshot.rightPosition = right;
+        snapshot.imuValidA = snapshot.imuValidB = true;
+        snapshot.imuHeadingA = wrap(startHeading + turnedA + driftA + 0.001 * normal(rng));
+        snapshot.imuHeadingB = wrap(startHeading + turnedB + driftB + 0.001 * normal(rng));
+        snapshot.imuHeading = wrap(snapshot.imuHeadingA + deltaInHeading(snapshot.imuHeadingB, snapshot.imuHeadingA) / 2);
+
+        // The GPS holds its last reading between updates. It sometimes loses the field strip and says so, and
+        // sometimes reads a reflection without saying so
+        if (t >= nextGps) {
+            nextGps += GPS_PERIOD;
+            int lagged = (int) run.truth.size() - gpsLagTicks;
+            const Truth& seen = gpsLagTicks == 0 ? truth : lagged < 0 ? start : run.truth[lagged];
+            if (dropoutLeft <= 0 && uniform(rng) < 0.002) dropoutLeft = 0.5 + 1.5 * uniform(rng);
+            if (dropoutLeft > 0) {
+                dropoutLeft -= GPS_PERIOD;
+                gpsError = 0.05 + 0.1 * uniform(rng);
+                gpsX = seen.x + 12 * normal(rng);
+                gpsY = seen.y + 12 * normal(rng);
+                gpsHeading = wrap(seen.heading + 0.3 * normal(rng));
+            } else {
+                gpsError = 0.008 + 0.004 * uniform(rng);
+                double noise = gpsError * METERS_TO_INCHES;
+                gpsX = seen.x + noise * normal(rng);
+                gpsY = seen.y + noise * normal(rng);
+                gpsHeading = wrap(seen.heading + getRadians(1) * normal(rng));
+                if (uniform(rng) < 0.01) {
+                    gpsX += 15 * normal(rng);
+                    gpsY += 15 * normal(rng);
+                }
+            }
+        }
+        snapshot.hasGps = true;
+        snapshot.gpsX = gpsX;
+        snapshot.gpsY = gpsY;
+        snapshot.gpsHeading = gpsHeading;
+        snapshot.gpsError = gpsError;
+
+        run.snapshots.push_back(snapshot);
+        run.truth.push_back(truth);
+    }
+    return run;
+}
+
+// Replays a run through a filter that starts at the true position, like after setPosition() at the start of auton
+template <typename Filter>
+static void evaluate(const Run& run, Filter filter, Errors& errors) {
+
+    filter.setPosition(run.truth[0].x, run.truth[0].y);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Truth> estimates(run.snapshots.size());
+    for (size_t i = 0; i < run.snapshots.size(); i++) {
+        filter.update(run.snapshots[i]);
+        estimates[i] = {filter.currentX, filter.currentY, filter.currentHeading};
+    }
+    errors.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    for (size_t i = 0; i < run.snapshots.size(); i++) {
+        errors.add(estimates[i].x, estimates[i].y, estimates[i].heading, run.truth[i]);
+    }
+}
+
+typedef struct Row {
+    const char* name;
+    Errors total, worst; // worst is the run with the highest rms
+} Row;
+
+static void addRun(Row& row, const Errors& run) {
+    if (run.getPositionRms() > row.worst.getPositionRms()) row.worst = run;
+    row.total.merge(run);
+}
+
+int main(int argc, char** argv) {
+
+    int runs = 50;
+    double seconds = 30;
+    double gpsLatency = 0.02;
+    unsigned seed = 1;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--runs") && i + 1 < argc) runs = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--seconds") && i + 1 < argc) seconds = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--gps-latency") && i + 1 < argc) gpsLatency = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--seed") && i + 1 < argc) seed = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "Usage: %s [--runs n] [--seconds s] [--gps-latency s] [--seed n]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    PoseEKF ekf;
+    ekf.noise.gpsLatency = gpsLatency;
+    PoseEKF ekfNoLatency; // fusing every GPS reading as if it were current
+    ekfNoLatency.noise.gpsLatency = 0;
+
+    Row rows[] = {{"OdometryFilter", {}, {}}, {"PoseEKF, no lag", {}, {}}, {"PoseEKF", {}, {}}};
+    for (int r = 0; r < runs; r++) {
+        std::mt19937 rng(seed + r);
+        Run run = generate(rng, seconds, gpsLatency);
+
+        Errors results[3];
+        evaluate(run, sim::OdometryFilter(), results[0]);
+        evaluate(run, ekfNoLatency, results[1]);
+        evaluate(run, ekf, results[2]);
+        for (int i = 0; i < 3; i++) addRun(rows[i], results[i]);
+    }
+
+    printf("%d runs of %.0f s, GPS %.0f ms late, %llu updates per filter\n", runs, seconds, gpsLatency * 1000,
+        (unsigned long long) rows[0].total.count);
+    printf("%-16s %12s %12s %12s %14s %12s\n", "filter", "rms in", "max in", "rms deg", "worst run rms", "ns/update");
+    for (const Row& row : rows) {
+        const Errors& e = row.total;
+        printf("%-16s %12.3f %12.3f %12.3f %14.3f %12.1f\n", row.name, e.getPositionRms(), e.positionMax,
+            getDegrees(e.getHeadingRms()), row.worst.getPositionRms(), e.seconds / e.count * 1e9);
+    }
+    return 0;
+}
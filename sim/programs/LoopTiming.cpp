@@ -0,0 +1,62 @@
+// Runs goForwardTimedU on the 15" robot in a simulated brain, with the localizer and flywheel on the executive
+// like in autonomous(), and reports how long the control loop takes in virtual time versus wall-clock time, how
+// many PROS calls it makes (screen output goes through the rate-limited display task), how well it holds its period and the CPU time of each executive callback
+
+#include "Simulation/World.h"
+#include "Simulation/FlywheelPlant.h"
+#include "Subsystems/RobotBuilder.h"
+#include "AutonomousFunctions/DriveFunctions.h"
+#include "misc/Display.h"
+#include <chrono>
+#include <stdio.h>
+
+int main() {
+
+    sim::World world;
+    Robot robot = getRobot15(false);
+
+    sim::FlywheelPlant flywheel(world, sim::getRobot15Flywheel(robot.flywheel->getVoltRpmData()));
+
+    pros::lcd::initialize();
+    world.run([&] { robot.localizer->init(); }, 10, "Initialize");
+
+    const double DRIVE_SECONDS = 5;
+    sim::DeviceStats before = world.stats;
+    double virtualStart = world.getSeconds();
+    auto wallStart = std::chrono::steady_clock::now();
+
+    bool finished = world.run([&] {
+        display.start();
+        scheduleLocalizer(robot);
+        scheduleFlywheel(robot);
+        goForwardTimedU(robot, SimplePID({1, 0, 0}), DRIVE_SECONDS, 0.5);
+    }, DRIVE_SECONDS + 5);
+
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    double virtualSeconds = world.getSeconds() - virtualStart;
+
+    uint64_t reads = world.stats.deviceReads - before.deviceReads;
+    uint64_t writes = world.stats.deviceWrites - before.deviceWrites;
+    uint64_t lcdCalls = world.stats.lcdCalls - before.lcdCalls;
+
+    printf("finished: %s\n", finished ? "yes" : "no");
+    printf("virtual time: %.3f s, wall time: %.3f s, speedup: %.0fx\n",
+        virtualSeconds, wallSeconds, virtualSeconds / wallSeconds);
+    printf("per second: %.0f device reads, %.0f device writes, %.0f lcd calls\n",
+        reads / virtualSeconds, writes / virtualSeconds, lcdCalls / virtualSeconds);
+    printf("display: %u posts (%u dropped), %u frames, %u lines drawn\n", display.getPosts(), display.getDropped(),
+        display.getFrames(), display.getLinesDrawn());
+    MotorOutputStats output = robot.drive->getOutputStats();
+    printf("drive motor commands: %u written, %u suppressed as repeats\n", output.written, output.suppressed);
+    const LoopTiming& motion = robot.drive->motionTiming;
+    printf("loop: %u iterations, %u overruns, start jitter mean %.0f us max %u us, body max %u us\n",
+        motion.iterations, motion.overruns, motion.getMeanJitter(), motion.maxJitter, motion.maxBodyTime);
+    for (int i = 0; i < robot.executive->getCallbackCount(); i++) {
+        CallbackStats stats = robot.executive->getStats(i);
+        printf("executive %-16s every %3u ms: %5u runs, mean %5.0f us, max %5u us\n", stats.name, stats.period,
+            stats.runs, stats.getMeanTime(), stats.maxTime);
+    }
+    printf("final drive distance: %.2f in\n", robot.drive->getDistance());
+
+    return finished ? 0 : 1;
+}
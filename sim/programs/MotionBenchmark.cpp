@@ -0,0 +1,254 @@
+// Drives goForwardU, goTurnU, goCurveU, goToPoint and goForwardTimedU through a grid of distances, angles,
+// radii and max speeds on a simulated 15" drivetrain, and writes settle time, final error, peak effort and
+// control loop iterations for every case as CSV or JSON. Diff two reports to catch auton cycle time
+// regressions before they show up on the field. --telemetry records every case's binary telemetry log into one
+// file, for DecodeTelemetry. --odometry-period sets how often odometry updates in the cases that use it.
+//
+// Usage: MotionBenchmark [--json] [--output file] [--telemetry file] [--odometry-period ms]
+
+#include "Simulation/World.h"
+#include "Simulation/DrivetrainPlant.h"
+#include "Simulation/Harness.h"
+#include "Subsystems/RobotBuilder.h"
+#include "Subsystems/Localizer/Odometry.h"
+#include "AutonomousFunctions/DriveFunctions.h"
+#include "AutonomousFunctions/PIDPresets.h"
+#include "misc/Telemetry.h"
+#include <chrono>
+#include <functional>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+static constexpr double TIMEOUT_SECONDS = 10;
+static constexpr uint8_t GPS_PORT = 7; // free port on the 15" robot, for the cases that need odometry
+
+typedef struct Pose {
+    double x, y, heading; // inches, radians
+} Pose;
+
+typedef struct Case {
+    std::string function;
+    std::string parameters;
+    const char* errorUnit;
+    bool needsOdometry;
+    std::function<void(Robot&)> run;
+    std::function<double(const sim::DrivetrainPlant&, Pose)> error; // signed error from the true final pose
+} Case;
+
+typedef struct Result {
+    bool completed;
+    double settleTime; // seconds until the function returned
+    double errorAtExit, errorAtRest; // errorAtRest is measured after coasting for 0.5 s
+    double peakEffort; // largest |voltage| / 12V commanded to any drive motor
+    uint64_t iterations; // control loop iterations
+} Result;
+
+static std::string format(const char* fmt, double a, double b = 0, double c = 0) {
+    char buffer[96];
+    snprintf(buffer, sizeof(buffer), fmt, a, b, c);
+    return buffer;
+}
+
+// Distance travelled along the starting heading, inches
+static double progress(const sim::DrivetrainPlant& plant, Pose start) {
+    return (plant.getX() - start.x) * cos(start.heading) + (plant.getY() - start.y) * sin(start.heading);
+}
+
+static double turned(const sim::DrivetrainPlant& plant, Pose start) {
+    return getDegrees(plant.getHeading() - start.heading);
+}
+
+static std::vector<Case> buildCases() {
+
+    std::vector<Case> cases;
+
+    for (double maxSpeed : {0.4, 0.6, 0.8}) {
+        for (double distance : {6.0, 12.0, 24.0, 48.0, -24.0}) {
+            cases.push_back({"goForwardU", format("distance=%g maxSpeed=%g", distance, maxSpeed), "in", false,
+                [=](Robot& robot) { goForwardU(robot, GFU_DIST_PRECISE(maxSpeed), GFU_TURN, distance); },
+                [=](const sim::DrivetrainPlant& plant, Pose start) { return distance - progress(plant, start); }
+            });
+        }
+    }
+
+    for (double degrees : {15.0, 45.0, 90.0, 180.0, -90.0}) {
+        cases.push_back({"goTurnU", format("degrees=%g preset=GTU_TURN", degrees), "deg", false,
+            [=](Robot& robot) { goTurnU(robot, GTU_TURN, getRadians(degrees)); },
+            [=](const sim::DrivetrainPlant& plant, Pose start) { return degrees - turned(plant, start); }
+        });
+        cases.push_back({"goTurnU", format("degrees=%g preset=GTU_TURN_PRECISE", degrees), "deg", false,
+            [=](Robot& robot) { goTurnU(robot, GTU_TURN_PRECISE, getRadians(degrees)); },
+            [=](const sim::DrivetrainPlant& plant, Pose start) { return degrees - turned(plant, start); }
+        });
+    }
+
+    for (double maxSpeed : {0.4, 0.8}) {
+        for (double radius : {12.0, 24.0, 48.0, -24.0}) {
+            for (double degrees : {45.0, 90.0, -90.0}) {
+                cases.push_back({"goCurveU", format("radius=%g degrees=%g maxSpeed=%g", radius, degrees, maxSpeed),
+                    "deg", false,
+                    [=](Robot& robot) {
+                        goCurveU(robot, GFU_DIST_PRECISE(maxSpeed), GCU_CURVE, 0, getRadians(degrees), radius);
+                    },
+                    [=](const sim::DrivetrainPlant& plant, Pose start) { return degrees - turned(plant, start); }
+                });
+            }
+        }
+    }
+
+    for (double maxSpeed : {0.4, 0.8}) {
+        for (Pose goal : std::vector<Pose>{{24, 0, 0}, {36, 12, 0}, {48, -12, 0}, {24, 24, 0}}) {
+            cases.push_back({"goToPoint", format("x=%g y=%g maxSpeed=%g", goal.x, goal.y, maxSpeed), "in", true,
+                [=](Robot& robot) { goToPoint(robot, GFU_DIST_PRECISE(maxSpeed), GFU_TURN, goal.x, goal.y); },
+                [=](const sim::DrivetrainPlant& plant, Pose start) {
+                    return hypot(goal.x - plant.getX(), goal.y - plant.getY());
+                }
+            });
+        }
+    }
+
+    for (double seconds : {0.5, 1.0, 2.0}) {
+        for (double effort : {0.3, 0.6, -0.3}) {
+            cases.push_back({"goForwardTimedU", format("seconds=%g effort=%g", seconds, effort), "deg", false,
+                [=](Robot& robot) { goForwardTimedU(robot, GFU_TURN, seconds, effort); },
+                [=](const sim::DrivetrainPlant& plant, Pose start) { return -turned(plant, start); }
+            });
+        }
+    }
+
+    return cases;
+}
+
+static Result runCase(const Case& c, uint32_t odometryPeriod) {
+
+    sim::World world;
+    Robot robot = getRobot15(false);
+
+    sim::DrivetrainParameters params = sim::getRobot15Drivetrain();
+    Odometry* odometry = nullptr;
+    if (c.needsOdometry) {
+        params.gpsPort = GPS_PORT;
+        odometry = new Odometry(*robot.drive, params.imuPorts[0], params.imuPorts[1], GPS_PORT, 0, 0);
+        robot.localizer.reset(odometry);
+    }
+    sim::DrivetrainPlant plant(world, params);
+
+    pros::lcd::initialize();
+    world.run([&] {
+        if (odometry) odometry->setUpdatePeriod(odometryPeriod);
+        robot.localizer->init();
+        robot.drive->setBrakeMode(pros::E_MOTOR_BRAKE_BRAKE);
+    }, 10, "Initialize");
+
+    if (telemetry.isRunning()) {
+        world.run([] {
+            pros::Task([] { telemetry.drainTask(); }, TASK_PRIORITY_MIN, TASK_STACK_DEPTH_DEFAULT, "Telemetry");
+        }, 1);
+    }
+    if (c.needsOdometry) {
+        world.run([&] { pros::Task([&] { robot.localizer->updatePositionTask(); }, "Odometry"); }, 1);
+        world.runFor(0.1);
+    }
+
+    std::vector<sim::SimMotor*> motors;
+    for (auto ports : {params.leftPorts, params.rightPorts}) {
+        for (int8_t port : ports) motors.push_back(world.getMotor(abs(port)));
+    }
+
+    double peakEffort = 0;
+    sim::StepProbe probe(world, [&] {
+        for (sim::SimMotor* motor : motors) {
+            if (motor->mode == sim::SimMotor::Mode::VOLTAGE) peakEffort = fmax(peakEffort, fabs(motor->targetVoltage) / 12);
+        }
+    });
+
+    Pose start = {plant.getX(), plant.getY(), plant.getHeading()};
+    uint32_t startIterations = robot.drive->motionTiming.iterations;
+    double startTime = world.getSeconds();
+
+    Result result;
+    int saved = sim::silenceStdout();
+    result.completed = world.run([&] { c.run(robot); }, TIMEOUT_SECONDS);
+    sim::restoreStdout(saved);
+
+    result.settleTime = world.getSeconds() - startTime;
+    result.iterations = robot.drive->motionTiming.iterations - startIterations;
+    result.peakEffort = peakEffort;
+    result.errorAtExit = c.error(plant, start);
+    world.runFor(0.5);
+    result.errorAtRest = c.error(plant, start);
+    if (telemetry.isRunning()) world.run([] { telemetry.drain(); }, 1); // whatever the task hadn't written yet
+
+    return result;
+}
+
+int main(int argc, char** argv) {
+
+    bool json = false;
+    const char* outputPath = nullptr;
+    const char* telemetryPath = nullptr;
+    uint32_t odometryPeriod = Odometry::DEFAULT_UPDATE_PERIOD;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--json")) json = true;
+        else if (!strcmp(argv[i], "--output") && i + 1 < argc) outputPath = argv[++i];
+        else if (!strcmp(argv[i], "--telemetry") && i + 1 < argc) telemetryPath = argv[++i];
+        else if (!strcmp(argv[i], "--odometry-period") && i + 1 < argc) odometryPeriod = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "Usage: %s [--json] [--output file] [--telemetry file] [--odometry-period ms]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    FILE* telemetryFile = nullptr;
+    if (telemetryPath && !(telemetryFile = fopen(telemetryPath, "wb"))) {
+        perror(telemetryPath);
+        return 1;
+    }
+    if (telemetryFile) telemetry.open(telemetryFile);
+
+    FILE* output = stdout;
+    if (outputPath && !(output = fopen(outputPath, "w"))) {
+        perror(outputPath);
+        return 1;
+    }
+
+    auto wallStart = std::chrono::steady_clock::now();
+    std::vector<Case> cases = buildCases();
+
+    if (json) fprintf(output, "[\n");
+    else fprintf(output, "function,parameters,completed,settle_s,error_exit,error_rest,error_unit,peak_effort,iterations\n");
+
+    int timeouts = 0;
+    for (size_t i = 0; i < cases.size(); i++) {
+
+        const Case& c = cases[i];
+        Result r = runCase(c, odometryPeriod);
+        if (!r.completed) timeouts++;
+
+        if (json) {
+            fprintf(output, "  {\"function\": \"%s\", \"parameters\": \"%s\", \"completed\": %s, \"settle_s\": %.3f, "
+                "\"error_exit\": %.3f, \"error_rest\": %.3f, \"error_unit\": \"%s\", \"peak_effort\": %.3f, "
+                "\"iterations\": %llu}%s\n", c.function.c_str(), c.parameters.c_str(), r.completed ? "true" : "false",
+                r.settleTime, r.errorAtExit, r.errorAtRest, c.errorUnit, r.peakEffort,
+                (unsigned long long) r.iterations, i + 1 < cases.size() ? "," : "");
+        } else {
+            fprintf(output, "%s,%s,%d,%.3f,%.3f,%.3f,%s,%.3f,%llu\n", c.function.c_str(), c.parameters.c_str(),
+                r.completed, r.settleTime, r.errorAtExit, r.errorAtRest, c.errorUnit, r.peakEffort,
+                (unsigned long long) r.iterations);
+        }
+    }
+    if (json) fprintf(output, "]\n");
+    if (output != stdout) fclose(output);
+    if (telemetryFile) {
+        fclose(telemetryFile);
+        fprintf(stderr, "telemetry: %u records in %u bytes, %u dropped\n", telemetry.getWritten(),
+            telemetry.getBytesWritten(), telemetry.getDropped());
+    }
+
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    fprintf(stderr, "%zu cases, %d did not finish within %.0f s. Wall time: %.2f s\n", cases.size(), timeouts,
+        TIMEOUT_SECONDS, wallSeconds);
+
+    return 0;
+}
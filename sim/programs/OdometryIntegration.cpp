@@ -0,0 +1,228 @@
+// Dead reckoning error of the ways odometry can integrate encoder travel and heading, at several update rates, with
+// perfect sensors so only the integration itself is measured. Each run drives random arcs, straights and nearly
+// straight segments (which is where dividing by the turn to get a radius loses precision). Reports the position
+// error against the true path and the host CPU time per update, including PoseEKF dead reckoning with no GPS.
+//
+// --sensor-period holds the encoders and IMUs between reports like the real devices (10 ms by default on V5), to
+// see how much of a faster update rate survives sensors that report slower.
+//
+// Usage: OdometryIntegration [--runs n] [--seconds s] [--sensor-period ms] [--seed n]
+
+#include "Subsystems/Localizer/PoseEKF.h"
+#include "misc/MathUtility.h"
+#include <chrono>
+#include <math.h>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+static const double TRACK_WIDTH = 12; // inches
+static const double TRUTH_PERIOD = 0.0001; // seconds
+static const int RATES[] = {50, 100, 200, 500, 1000}; // Hz
+
+typedef struct Sample {
+    double time, left, right, heading; // heading continuous, not wrapped
+    double x, y; // truth
+} Sample;
+
+typedef struct Integrator {
+    const char* name;
+    // Advance (x, y) given the heading before and after and the distance travelled
+    void (*step)(double& x, double& y, double prevHeading, double heading, double distance);
+} Integrator;
+
+static void stepEuler(double& x, double& y, double prevHeading, double heading, double distance) {
+    x += distance * cos(prevHeading);
+    y += distance * sin(prevHeading);
+}
+
+static void stepMidpoint(double& x, double& y, double prevHeading, double heading, double distance) {
+    x += distance * cos((prevHeading + heading) / 2);
+    y += distance * sin((prevHeading + heading) / 2);
+}
+
+// Constant radius arc with a special case for exactly straight, as odometry used to integrate
+static void stepRadius(double& x, double& y, double prevHeading, double heading, double distance) {
+    double turn = heading - prevHeading;
+    if (turn == 0) {
+        x += distance * cos(heading);
+        y += distance * sin(heading);
+    } else {
+        double radius = distance / turn;
+        x += radius * (sin(heading) - sin(prevHeading));
+        y -= radius * (cos(heading) - cos(prevHeading));
+    }
+}
+
+static void stepArc(double& x, double& y, double prevHeading, double heading, double distance) {
+    integrateArc(x, y, prevHeading, distance, heading - prevHeading);
+}
+
+static const Integrator INTEGRATORS[] = {
+    {"euler", stepEuler},
+    {"midpoint", stepMidpoint},
+    {"radius", stepRadius},
+    {"arc (sinc)", stepArc},
+};
+
+typedef struct Errors {
+    uint64_t count = 0;
+    double squared = 0, finalSum = 0, seconds = 0;
+    int runs = 0;
+
+    double getRms() const { return count ? sqrt(squared / count) : 0; }
+    double getMeanFinal() const { return runs ? finalSum / runs : 0; }
+} Errors;
+
+// The true path at TRUTH_PERIOD, with what perfect sensors would read
+static std::vector<Sample> generate(std::mt19937& rng, double seconds) {
+
+    std::normal_distribution<double> normal(0, 1);
+    std::uniform_real_distribution<double> uniform(0, 1);
+
+    std::vector<Sample> path;
+    Sample s = {0, 0, 0, uniform(rng) * 2 * M_PI, 0, 0};
+    double velocity = 0, turnRate = 0, targetVelocity = 0, targetTurnRate = 0, segmentLeft = 0;
+
+    for (s.time = 0; s.time < seconds; s.time += TRUTH_PERIOD) {
+
+        if (segmentLeft <= 0) {
+            segmentLeft = 0.5 + 2 * uniform(rng);
+            targetVelocity = uniform(rng) * 140 - 60;
+            double kind = uniform(rng);
+            if (kind < 0.2) targetTurnRate = 0;
+            else if (kind < 0.4) targetTurnRate = 1e-6 * normal(rng); // drifting off straight
+            else targetTurnRate = uniform(rng) * 12 - 6;
+        }
+        segmentLeft -= TRUTH_PERIOD;
+
+        velocity += (targetVelocity - velocity) * TRUTH_PERIOD / 0.15;
+        turnRate += (targetTurnRate - turnRate) * TRUTH_PERIOD / 0.15;
+
+        double distance = velocity * TRUTH_PERIOD;
+        double turn = turnRate * TRUTH_PERIOD;
+        integrateArc(s.x, s.y, s.heading, distance, turn);
+        s.heading += turn;
+        s.left += distance - turn * TRACK_WIDTH / 2;
+        s.right += distance + turn * TRACK_WIDTH / 2;
+        path.push_back(s);
+    }
+    return path;
+}
+
+// Readings at rate, each holding the last sensor report at most sensorPeriod old
+static std::vector<Sample> sampleAt(const std::vector<Sample>& path, int rate, double sensorPeriod) {
+    std::vector<Sample> samples;
+    int stride = (int) lround(1.0 / rate / TRUTH_PERIOD);
+    int hold = sensorPeriod > 0 ? (int) lround(sensorPeriod / TRUTH_PERIOD) : 1;
+    for (size_t i = stride - 1; i < path.size(); i += stride) {
+        Sample sample = path[i];
+        const Sample& reported = path[i - i % hold];
+        sample.left = reported.left;
+        sample.right = reported.right;
+        sample.heading = reported.heading;
+        samples.push_back(sample);
+    }
+    return samples;
+}
+
+static void addError(Errors& errors, double x, double y, const Sample& truth) {
+    double error = getDistance(x, y, truth.x, truth.y);
+    errors.squared += error * error;
+    errors.count++;
+}
+
+static void evaluate(const std::vector<Sample>& samples, const Integrator& integrator, Errors& errors) {
+
+    double x = 0, y = 0;
+    std::vector<double> xs(samples.size()), ys(samples.size());
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 1; i < samples.size(); i++) {
+        const Sample& prev = samples[i - 1];
+        const Sample& s = samples[i];
+        integrator.step(x, y, prev.heading, s.heading, (s.left - prev.left + s.right - prev.right) / 2);
+        xs[i] = x;
+        ys[i] = y;
+    }
+    errors.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Relative to the first sample, where the integration starts
+    for (size_t i = 1; i < samples.size(); i++) {
+        addError(errors, xs[i] + samples[0].x, ys[i] + samples[0].y, samples[i]);
+    }
+    errors.finalSum += getDistance(x + samples[0].x, y + samples[0].y, samples.back().x, samples.back().y);
+    errors.runs++;
+}
+
+static void evaluateEkf(const std::vector<Sample>& samples, Errors& errors) {
+
+    PoseEKF filter;
+    filter.setPosition(samples[0].x, samples[0].y);
+    std::vector<SensorSnapshot> snapshots(samples.size());
+    for (size_t i = 0; i < samples.size(); i++) {
+        snapshots[i].time = (uint64_t) llround(samples[i].time * 1000000);
+        snapshots[i].leftPosition = samples[i].left;
+        snapshots[i].rightPosition = samples[i].right;
+        double heading = fmod(samples[i].heading, 2 * M_PI);
+        snapshots[i].imuHeading = heading < 0 ? heading + 2 * M_PI : heading;
+    }
+
+    std::vector<double> xs(samples.size()), ys(samples.size());
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < samples.size(); i++) {
+        filter.update(snapshots[i]);
+        xs[i] = filter.currentX;
+        ys[i] = filter.currentY;
+    }
+    errors.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    for (size_t i = 1; i < samples.size(); i++) addError(errors, xs[i], ys[i], samples[i]);
+    errors.finalSum += getDistance(xs.back(), ys.back(), samples.back().x, samples.back().y);
+    errors.runs++;
+}
+
+int main(int argc, char** argv) {
+
+    int runs = 20;
+    double seconds = 30;
+    double sensorPeriod = 0;
+    unsigned seed = 1;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--runs") && i + 1 < argc) runs = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--seconds") && i + 1 < argc) seconds = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--sensor-period") && i + 1 < argc) sensorPeriod = atof(argv[++i]) / 1000;
+        else if (!strcmp(argv[i], "--seed") && i + 1 < argc) seed = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "Usage: %s [--runs n] [--seconds s] [--sensor-period ms] [--seed n]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    const int INTEGRATOR_COUNT = sizeof(INTEGRATORS) / sizeof(INTEGRATORS[0]);
+    const int RATE_COUNT = sizeof(RATES) / sizeof(RATES[0]);
+    Errors errors[RATE_COUNT][INTEGRATOR_COUNT + 1]; // the last column is PoseEKF
+
+    for (int r = 0; r < runs; r++) {
+        std::mt19937 rng(seed + r);
+        std::vector<Sample> path = generate(rng, seconds);
+        for (int rate = 0; rate < RATE_COUNT; rate++) {
+            std::vector<Sample> samples = sampleAt(path, RATES[rate], sensorPeriod);
+            for (int i = 0; i < INTEGRATOR_COUNT; i++) evaluate(samples, INTEGRATORS[i], errors[rate][i]);
+            evaluateEkf(samples, errors[rate][INTEGRATOR_COUNT]);
+        }
+    }
+
+    if (sensorPeriod > 0) printf("%d runs of %.0f s, sensors report every %.0f ms\n", runs, seconds, sensorPeriod * 1000);
+    else printf("%d runs of %.0f s, sensors fresh at every update\n", runs, seconds);
+    printf("%-6s %-12s %12s %14s %12s\n", "Hz", "integrator", "rms in", "mean final in", "ns/update");
+    for (int rate = 0; rate < RATE_COUNT; rate++) {
+        for (int i = 0; i <= INTEGRATOR_COUNT; i++) {
+            const Errors& e = errors[rate][i];
+            printf("%-6d %-12s %12.5f %14.5f %12.1f\n", RATES[rate], i < INTEGRATOR_COUNT ? INTEGRATORS[i].name
+                : "PoseEKF", e.getRms(), e.getMeanFinal(), e.seconds / e.count * 1e9);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,199 @@
+// Offline replacement for TuningDriver sessions: evaluates ForwardTest or TurnTest on a simulated 15" robot
+// and searches their parameters with CMA-ES, evaluating each generation on all host cores. The cost of a
+// candidate is the test's error plus a weight times the time it took, the two numbers TuningDriver shows
+// on the brain. Prints the best parameters as a preset ready to paste into PIDPresets.h.
+//
+// Usage: PIDTuner [forward|turn] [--generations n] [--population n] [--threads n] [--time-weight w]
+//                 [--fix NAME=value ...]
+
+#include "Simulation/World.h"
+#include "Simulation/CmaEs.h"
+#include "Simulation/DrivetrainPlant.h"
+#include "Simulation/Harness.h"
+#include "Subsystems/RobotBuilder.h"
+#include "Programs/TestFunction/ForwardTest.h"
+#include "Programs/TestFunction/TurnTest.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+
+static constexpr double TIMEOUT_SECONDS = 30;
+static constexpr double TIMEOUT_COST = 1e6;
+
+typedef struct Objective {
+    const char* name;
+    std::function<AbstractTest*()> create;
+    std::vector<std::string> fixedByDefault; // parameters that are choices rather than gains
+    std::function<void(const std::vector<double>&)> printPreset;
+} Objective;
+
+static const Objective OBJECTIVES[] = {
+    {"forward", [] { return new ForwardTest(); }, {"SPEED"}, [](const std::vector<double>& v) {
+        printf("#define GFU_DIST_PRECISE(maxSpeed) DoubleBoundedPID({%.4g, 0, %.4g, %.4g, clamp(maxSpeed,-%.2g,%.2g), "
+            "%.4g}, %.4g, 3)\n", v[0], v[1], v[2], v[5], v[5], v[3], v[4]);
+    }},
+    {"turn", [] { return new TurnTest(); }, {}, [](const std::vector<double>& v) {
+        printf("#define GTU_TURN_PRECISE DoubleBoundedPID({%.4g, %.4g, %.4g, %.4g, 1}, getRadians(%.4g), 3)\n",
+            v[0], v[1], v[2], v[3], v[4]);
+    }},
+};
+
+// Run the test once on a fresh robot. Returns its error and time, or time < 0 if it did not finish
+static TestData evaluate(const Objective& objective, const std::vector<double>& values) {
+
+    sim::World world;
+    Robot robot = getRobot15(false);
+    sim::DrivetrainPlant plant(world, sim::getRobot15Drivetrain());
+
+    std::unique_ptr<AbstractTest> test(objective.create());
+    test->paramValues = values;
+
+    pros::lcd::initialize();
+    world.run([&] {
+        robot.localizer->init();
+        robot.drive->setBrakeMode(pros::E_MOTOR_BRAKE_BRAKE);
+    }, 10, "Initialize");
+
+    TestData data = {0, -1};
+    world.run([&] { data = test->run(robot); }, TIMEOUT_SECONDS);
+    return data;
+}
+
+int main(int argc, char** argv) {
+
+    const Objective* objective = &OBJECTIVES[0];
+    int generations = 30;
+    int population = 0;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    double timeWeight = 1; // cost of one second, in units of the test's error
+    std::vector<std::pair<std::string, double>> fixes;
+    bool fixDefaults = true;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (!strcmp(argv[i], "--generations") && hasValue) generations = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--population") && hasValue) population = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--threads") && hasValue) threads = std::max(1, atoi(argv[++i]));
+        else if (!strcmp(argv[i], "--time-weight") && hasValue) timeWeight = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--free-all")) fixDefaults = false;
+        else if (!strcmp(argv[i], "--fix") && hasValue) {
+            std::string fix = argv[++i];
+            size_t equals = fix.find('=');
+            if (equals == std::string::npos) fixes.push_back({fix, NAN});
+            else fixes.push_back({fix.substr(0, equals), atof(fix.c_str() + equals + 1)});
+        } else {
+            objective = nullptr;
+            for (const Objective& o : OBJECTIVES) if (!strcmp(argv[i], o.name)) objective = &o;
+            if (!objective) {
+                fprintf(stderr, "Usage: %s [forward|turn] [--generations n] [--population n] [--threads n] "
+                    "[--time-weight w] [--fix NAME[=value] ...] [--free-all]\n", argv[0]);
+                return 1;
+            }
+        }
+    }
+
+    // The test's own starting values are the initial guess, like in TuningDriver
+    std::unique_ptr<AbstractTest> prototype(objective->create());
+    std::vector<std::string> names = prototype->paramNames;
+    std::vector<double> values = prototype->paramValues;
+
+    if (fixDefaults) {
+        for (const std::string& name : objective->fixedByDefault) fixes.push_back({name, NAN});
+    }
+
+    std::vector<bool> fixed(names.size(), false);
+    for (auto& fix : fixes) {
+        auto it = std::find(names.begin(), names.end(), fix.first);
+        if (it == names.end()) {
+            fprintf(stderr, "No parameter named %s\n", fix.first.c_str());
+            return 1;
+        }
+        fixed[it - names.begin()] = true;
+        if (!std::isnan(fix.second)) values[it - names.begin()] = fix.second;
+    }
+
+    // Search the free parameters in log space: gains are positive and scale-free, and a step of 0.1 is
+    // the same 10% nudge TuningDriver makes per button press
+    std::vector<int> free;
+    std::vector<double> start;
+    for (size_t i = 0; i < names.size(); i++) {
+        if (fixed[i]) continue;
+        free.push_back(i);
+        start.push_back(log(values[i]));
+    }
+
+    auto toValues = [&](const std::vector<double>& x) {
+        std::vector<double> v = values;
+        for (size_t k = 0; k < free.size(); k++) {
+            double initial = values[free[k]];
+            v[free[k]] = clamp(exp(x[k]), initial / 20, initial * 20); // stay within reason of the hand tuned value
+        }
+        return v;
+    };
+
+    auto cost = [&](const TestData& data) {
+        return data.time < 0 ? TIMEOUT_COST : data.error + timeWeight * data.time;
+    };
+
+    auto wallStart = std::chrono::steady_clock::now();
+    int savedStdout = sim::silenceStdout();
+
+    TestData initialData = evaluate(*objective, values);
+    std::vector<double> best = values;
+    TestData bestData = initialData;
+
+    sim::CmaEs optimizer(start, 0.3, std::max(population, 0));
+    int evaluations = 1;
+
+    for (int generation = 0; generation < generations; generation++) {
+
+        std::vector<std::vector<double>> candidates = optimizer.ask();
+        std::vector<TestData> results(candidates.size());
+
+        std::atomic<size_t> next(0);
+        std::vector<std::thread> workers;
+        for (unsigned t = 0; t < std::min<size_t>(threads, candidates.size()); t++) {
+            workers.emplace_back([&] {
+                for (size_t i = next++; i < candidates.size(); i = next++) {
+                    results[i] = evaluate(*objective, toValues(candidates[i]));
+                }
+            });
+        }
+        for (std::thread& worker : workers) worker.join();
+        evaluations += candidates.size();
+
+        std::vector<double> costs;
+        for (size_t i = 0; i < candidates.size(); i++) {
+            costs.push_back(cost(results[i]));
+            if (costs.back() < cost(bestData)) {
+                bestData = results[i];
+                best = toValues(candidates[i]);
+            }
+        }
+        optimizer.tell(candidates, costs);
+
+        fprintf(stderr, "generation %2d: best cost %.3f (error %.3f, time %.2f s), step size %.3f\n", generation + 1,
+            cost(bestData), bestData.error, bestData.time, optimizer.getSigma());
+    }
+
+    sim::restoreStdout(savedStdout);
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+    printf("%s test, %d evaluations on %u threads in %.1f s wall time. Cost = error + %.3g * seconds\n",
+        objective->name, evaluations, threads, wallSeconds, timeWeight);
+    printf("%-10s %10s %10s\n", "parameter", "initial", "tuned");
+    for (size_t i = 0; i < names.size(); i++) {
+        printf("%-10s %10.4g %10.4g%s\n", names[i].c_str(), values[i], best[i], fixed[i] ? "  (fixed)" : "");
+    }
+    printf("%-10s %10.3f %10.3f\n", "error", initialData.error, bestData.error);
+    printf("%-10s %10.2f %10.2f\n", "time (s)", initialData.time, bestData.time);
+    printf("\n");
+    objective->printPreset(best);
+
+    return 0;
+}
@@ -0,0 +1,159 @@
+// Runs AnselController's pure pursuit on a simulated 15" robot with odometry along a straight, an S-curve, a long
+// skills-style path and the routes generated at build time (PathFollowing/Routes.h), and reports completion time,
+// how far the true pose strayed from the path, the final error and the worst control loop body time. Each path runs
+// with the original, inverted steering law (before) and the current one (after). Then times
+// IndexedPath's per-tick lookups (projection, lookahead point and curvature) on the same path shape at increasing
+// lengths, to check a tick costs the same however long the path is.
+//
+// Usage: PathBenchmark
+
+#include "Simulation/World.h"
+#include "Simulation/DrivetrainPlant.h"
+#include "Simulation/Harness.h"
+#include "Subsystems/RobotBuilder.h"
+#include "Subsystems/Localizer/Odometry.h"
+#include "PathFollowing/AnselController.h"
+#include "PathFollowing/Routes.h"
+#include "AutonomousFunctions/DriveFunctions.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+static constexpr double TIMEOUT_SECONDS = 60; // the skills path takes about 30 s
+static constexpr uint8_t GPS_PORT = 7; // free port on the 15" robot
+static constexpr double SPACING = 1; // inches between waypoints
+
+typedef struct PathCase {
+    std::string name;
+    IndexedPath path;
+} PathCase;
+
+// Straight along +x, then S-bends of the given amplitude and wavelength, starting at the origin facing +x
+static std::vector<Waypoint> makePath(double straight, int bends, double amplitude, double wavelength) {
+    std::vector<Waypoint> path;
+    for (double x = 0; x < straight; x += SPACING) path.push_back({x, 0});
+    double length = bends * wavelength;
+    for (double t = 0; t <= length; t += SPACING) {
+        path.push_back({straight + t, amplitude * sin(2 * M_PI * t / wavelength)});
+    }
+    return path;
+}
+
+typedef struct Result {
+    bool completed;
+    double seconds;
+    double crossTrackRms, crossTrackMax; // true pose, inches
+    double finalError;
+    uint32_t maxBodyTime; // us
+} Result;
+
+static Result run(const IndexedPath& path, bool invertedSteering) {
+
+    sim::World world;
+    Robot robot = getRobot15(false);
+
+    sim::DrivetrainParameters params = sim::getRobot15Drivetrain();
+    params.gpsPort = GPS_PORT;
+    robot.localizer.reset(new Odometry(*robot.drive, params.imuPorts[0], params.imuPorts[1], GPS_PORT, 0, 0));
+    sim::DrivetrainPlant plant(world, params);
+    // Start on the path facing along it. Routes are in field coordinates
+    const PathPoint& first = path[0];
+    double startHeading = atan2(first.tangentY, first.tangentX);
+    plant.setPose(first.x, first.y, startHeading);
+
+    pros::lcd::initialize();
+    world.run([&] {
+        robot.localizer->init();
+        robot.localizer->setPosition(first.x, first.y);
+        robot.localizer->setHeading(startHeading);
+        robot.drive->setBrakeMode(pros::E_MOTOR_BRAKE_BRAKE);
+    }, 10, "Initialize");
+    world.run([&] { pros::Task([&] { robot.localizer->updatePositionTask(); }, "Odometry"); }, 1);
+    world.runFor(0.1);
+
+    int segment = 0;
+    double squared = 0, worst = 0;
+    uint64_t samples = 0;
+    sim::StepProbe probe(world, [&] {
+        PathProjection p = path.project(plant.getX(), plant.getY(), segment);
+        segment = p.segment;
+        squared += p.crossTrack * p.crossTrack;
+        worst = fmax(worst, fabs(p.crossTrack));
+        samples++;
+    });
+
+    AnselController controller;
+    controller.initRobot(&robot);
+    controller.invertedSteering = invertedSteering;
+    robot.drive->motionTiming = LoopTiming();
+
+    Result result;
+    double start = world.getSeconds();
+    int saved = sim::silenceStdout();
+    result.completed = world.run([&] { controller.runSegment(path); }, TIMEOUT_SECONDS);
+    sim::restoreStdout(saved);
+
+    result.seconds = world.getSeconds() - start;
+    result.crossTrackRms = samples ? sqrt(squared / samples) : 0;
+    result.crossTrackMax = worst;
+    const PathPoint& end = path[path.size() - 1];
+    result.finalError = hypot(end.x - plant.getX(), end.y - plant.getY());
+    result.maxBodyTime = robot.drive->motionTiming.maxBodyTime;
+    return result;
+}
+
+// Mean host time of one tick's lookups with a robot moving along the path a little off to one side
+static double timeLookups(const IndexedPath& path) {
+
+    const double STEP = 0.6; // inches per tick, about 60 in/s
+    int segment = 0;
+    uint64_t ticks = 0;
+    double checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (double s = 0; s < path.getLength(); s += STEP) {
+        Waypoint onPath = path.pointAt(s, segment);
+        const PathPoint& p = path[path.segmentAt(s, segment)];
+        double x = onPath.x - p.tangentY * 2, y = onPath.y + p.tangentX * 2;
+
+        PathProjection closest = path.project(x, y, segment);
+        segment = closest.segment;
+        Waypoint target = path.pointAt(closest.s + 12, segment);
+        checksum += target.x + path.curvatureAt(closest.s + 12, segment);
+        ticks++;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (checksum == 0.5) printf(" "); // keep the loop from being optimized away
+    return seconds / ticks * 1e9;
+}
+
+int main() {
+
+    std::vector<PathCase> cases = {
+        {"straight 72 in", makePath(72, 0, 0, 1)},
+        {"S-curve", makePath(12, 1, 12, 72)},
+        {"skills, 4 S-bends", makePath(12, 4, 12, 72)},
+    };
+    for (int i = 0; i < ROUTE_COUNT; i++) {
+        cases.push_back({std::string("route ") + ROUTES[i].name, getPath(ROUTES[i])});
+    }
+
+    printf("%-20s %8s %-8s %9s %9s %13s %9s %13s\n", "path", "length", "steering", "done", "time s", "cross rms/max",
+        "final in", "body max us");
+    for (const PathCase& c : cases) {
+        for (bool inverted : {true, false}) {
+            Result r = run(c.path, inverted);
+            printf("%-20s %8.1f %-8s %9s %9.2f %6.2f %6.2f %9.2f %13u\n", c.name.c_str(), c.path.getLength(),
+                inverted ? "before" : "after", r.completed ? "yes" : "timeout", r.seconds, r.crossTrackRms,
+                r.crossTrackMax, r.finalError, (unsigned) r.maxBodyTime);
+        }
+    }
+
+    printf("\n%-12s %12s %16s\n", "S-bends", "waypoints", "ns/tick lookups");
+    for (int bends : {1, 10, 100, 1000}) {
+        IndexedPath path(makePath(12, bends, 12, 72));
+        printf("%-12d %12d %16.1f\n", bends, path.size(), timeLookups(path));
+    }
+    return 0;
+}
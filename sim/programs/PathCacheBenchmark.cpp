@@ -0,0 +1,91 @@
+// Boots PathCache the three ways a robot can: with build-time tables current with RouteSpecs.h, with routes edited
+// since the tables were generated and nothing saved on the SD card yet (they are generated, then saved), and the
+// next boot with the same edits (they load from the card). Reports where each boot's routes came from and the host
+// time to make them all ready, checks a route loaded from the card matches the one generated, and that getPath()
+// answers not ready instead of waiting before the cache has run.
+//
+// The SD card is a temporary directory.
+//
+// Usage: PathCacheBenchmark
+
+#include "Simulation/World.h"
+#include "PathFollowing/PathCache.h"
+#include <chrono>
+#include <memory>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+typedef struct Boot {
+    double milliseconds;
+    uint32_t fromTables, fromSd, generated;
+} Boot;
+
+static Boot boot(PathCache& cache, const RouteSpec* specs, int count, const std::string& prefix) {
+
+    sim::World world;
+    auto start = std::chrono::steady_clock::now();
+    world.run([&] {
+        cache.start(specs, count, prefix.c_str());
+        while (!cache.isDone()) pros::delay(1);
+    }, 10);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return {seconds * 1000, cache.getFromTables(), cache.getFromSd(), cache.getGenerated()};
+}
+
+static bool samePath(const IndexedPath& a, const IndexedPath& b) {
+    if (a.size() != b.size()) return false;
+    for (int i = 0; i < a.size(); i++) {
+        if (memcmp(&a[i], &b[i], sizeof(PathPoint))) return false;
+    }
+    return true;
+}
+
+int main() {
+
+    char directory[] = "/tmp/pathcacheXXXXXX";
+    if (!mkdtemp(directory)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    std::string prefix = std::string(directory) + "/route_";
+
+    // The same routes ending an inch further along x, so their hashes no longer match the tables
+    RouteSpec edited[ROUTE_SPEC_COUNT];
+    for (int i = 0; i < ROUTE_SPEC_COUNT; i++) {
+        edited[i] = ROUTE_SPECS[i];
+        edited[i].poses[edited[i].poseCount - 1].x += 1;
+    }
+
+    std::unique_ptr<PathCache> notStarted(new PathCache());
+    IndexedPath path;
+    bool blocked = notStarted->getPath(ROUTE_SPECS[0].name, path);
+
+    std::unique_ptr<PathCache> current(new PathCache()), cold(new PathCache()), warm(new PathCache());
+    const char* names[] = {"tables current", "edited, cold", "edited, warm"};
+    Boot boots[] = {
+        boot(*current, ROUTE_SPECS, ROUTE_SPEC_COUNT, prefix),
+        boot(*cold, edited, ROUTE_SPEC_COUNT, prefix),
+        boot(*warm, edited, ROUTE_SPEC_COUNT, prefix),
+    };
+
+    printf("%d routes\n", ROUTE_SPEC_COUNT);
+    printf("%-16s %8s %8s %10s %12s\n", "boot", "tables", "SD card", "generated", "host ms");
+    for (int i = 0; i < 3; i++) {
+        printf("%-16s %8u %8u %10u %12.3f\n", names[i], (unsigned) boots[i].fromTables, (unsigned) boots[i].fromSd,
+            (unsigned) boots[i].generated, boots[i].milliseconds);
+    }
+
+    int matching = 0;
+    for (int i = 0; i < ROUTE_SPEC_COUNT; i++) {
+        IndexedPath generated, loaded;
+        if (cold->getPath(edited[i].name, generated) && warm->getPath(edited[i].name, loaded)
+            && samePath(generated, loaded)) matching++;
+    }
+    printf("\nroutes loaded from the SD card identical to generated: %d of %d\n", matching, ROUTE_SPEC_COUNT);
+    printf("getPath() before the cache ran: %s\n", blocked ? "returned a path" : "not ready, returned at once");
+
+    std::string command = std::string("rm -rf ") + directory;
+    return system(command.c_str()) == 0 && matching == ROUTE_SPEC_COUNT && !blocked ? 0 : 1;
+}
@@ -0,0 +1,237 @@
+// Replays the sensor streams in recorded telemetry logs (the sensors, odometryStart, odometrySetPosition and
+// odometrySetHeading channels, see misc/TelemetryFormat.h) through PoseEKF, the same code Odometry runs on the robot,
+// as fast as the host can go, or with --blend through the older OdometryFilter with overridable gains, to A/B a
+// change against any number of recorded runs. For each log it reports how far the replayed pose drifts from the pose
+// the robot recorded (zero with unchanged code and gains, up to fixed point rounding, for logs that record the
+// per-IMU headings, the sample time and whether the start position was set) and how well it agrees with the GPS
+// while the GPS is trusted, and can write the replayed pose trace as CSV.
+//
+// Usage: ReplayLocalization [--blend [--k-position k] [--k-heading k] [--gps-limit m]] [--trace prefix] log.bin...
+
+#include "Simulation/OdometryFilter.h"
+#include "misc/TelemetryFormat.h"
+#include "misc/MathUtility.h"
+#include "Subsystems/Localizer/PoseEKF.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+typedef struct Metrics {
+    uint32_t updates = 0, sessions = 0;
+
+    uint32_t recordedCount = 0; // updates the robot's own pose was logged for
+    double recordedSquared = 0, recordedMax = 0; // replayed vs recorded position, inches
+    double recordedHeadingMax = 0; // radians
+
+    uint32_t gpsCount = 0; // updates with a trusted GPS reading
+    double gpsSquared = 0, gpsHeadingSquared = 0;
+
+    double getRecordedRms() const { return recordedCount ? sqrt(recordedSquared / recordedCount) : 0; }
+    double getGpsRms() const { return gpsCount ? sqrt(gpsSquared / gpsCount) : 0; }
+    double getGpsHeadingRms() const { return gpsCount ? sqrt(gpsHeadingSquared / gpsCount) : 0; }
+} Metrics;
+
+static bool readFile(const char* path, std::vector<uint8_t>& out) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return false;
+    uint8_t chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) out.insert(out.end(), chunk, chunk + n);
+    fclose(file);
+    return true;
+}
+
+// Returns false if the log can't be read. Filter is OdometryFilter or PoseEKF, set up like prototype at each start
+template <typename Filter>
+static bool replay(const char* path, const Filter& prototype, double gpsErrorLimit, FILE* trace, Metrics& metrics) {
+
+    std::vector<uint8_t> log;
+    if (!readFile(path, log)) {
+        perror(path);
+        return false;
+    }
+
+    TelemetryDecoder decoder;
+    int offset = decoder.readHeader(log.data(), log.size());
+    if (offset <= 0) {
+        fprintf(stderr, "%s: not a telemetry log\n", path);
+        return false;
+    }
+
+    Filter filter = prototype;
+    bool inSession = false;
+    SensorSnapshot snapshot;
+
+    while (offset < (int) log.size()) {
+
+        uint8_t channel;
+        uint32_t time;
+        double v[TelemetryRecord::MAX_VALUES];
+        int read = decoder.decode(log.data() + offset, log.size() - offset, channel, time, v);
+        if (read <= 0) break; // the end of a log cut off mid-record
+        offset += read;
+
+        if (channel == TELEMETRY_ODOMETRY_START) {
+            // Only a position set before the start makes the EKF start certain of it. Older logs don't say
+            filter = prototype;
+            bool positionKnown = decoder.getChannel(channel).count < 3 || v[2] != 0;
+            if (positionKnown) filter.setPosition(v[0], v[1]);
+            inSession = true;
+            metrics.sessions++;
+
+        } else if (!inSession) {
+            continue; // before the first start there is nothing to replay into
+
+        } else if (channel == TELEMETRY_ODOMETRY_SET_POSITION) {
+            filter.setPosition(v[0], v[1]);
+
+        } else if (channel == TELEMETRY_ODOMETRY_SET_HEADING) {
+            SensorSnapshot imus;
+            imus.imuHeading = v[1];
+            imus.imuHeadingA = v[2];
+            imus.imuHeadingB = v[3];
+            imus.imuValidA = v[4] != 0;
+            imus.imuValidB = v[5] != 0;
+            filter.setHeading(v[0], imus);
+
+        } else if (channel == TELEMETRY_SENSORS) {
+            snapshot = SensorSnapshot();
+            int fields = decoder.getChannel(channel).count;
+            // The time the robot sampled, which can be some way before the record was logged. Older logs only have
+            // the record's time
+            snapshot.time = fields >= 12 ? time - (uint32_t) v[11] : time;
+            snapshot.groups = SENSE_ALL;
+            snapshot.leftPosition = v[0];
+            snapshot.rightPosition = v[1];
+            snapshot.imuHeading = v[2];
+            snapshot.hasGps = true;
+            snapshot.gpsX = v[3];
+            snapshot.gpsY = v[4];
+            snapshot.gpsHeading = v[5];
+            snapshot.gpsError = v[6];
+            if (fields >= 11) { // logs from before the per-IMU fields leave them invalid
+                snapshot.imuHeadingA = v[7];
+                snapshot.imuHeadingB = v[8];
+                snapshot.imuValidA = v[9] != 0;
+                snapshot.imuValidB = v[10] != 0;
+            }
+            filter.update(snapshot);
+            metrics.updates++;
+
+            if (snapshot.gpsError < gpsErrorLimit) {
+                double dx = filter.currentX - snapshot.gpsX, dy = filter.currentY - snapshot.gpsY;
+                double dh = deltaInHeading(filter.currentHeading, snapshot.gpsHeading);
+                metrics.gpsSquared += dx * dx + dy * dy;
+                metrics.gpsHeadingSquared += dh * dh;
+                metrics.gpsCount++;
+            }
+
+        } else if (channel == TELEMETRY_ODOMETRY) {
+            // Logged right after the sensors it came from
+            double dx = filter.currentX - v[0], dy = filter.currentY - v[1];
+            double distance = sqrt(dx * dx + dy * dy);
+            metrics.recordedSquared += distance * distance;
+            metrics.recordedMax = fmax(metrics.recordedMax, distance);
+            metrics.recordedHeadingMax = fmax(metrics.recordedHeadingMax,
+                fabs(deltaInHeading(filter.currentHeading, v[2])));
+            metrics.recordedCount++;
+
+            if (trace) {
+                fprintf(trace, "%.6f,%u,%.3f,%.3f,%.4f,%.3f,%.3f,%.4f,%.3f,%.3f,%.4f\n", time / 1e6, metrics.sessions,
+                    filter.currentX, filter.currentY, filter.currentHeading, v[0], v[1], v[2], snapshot.gpsX,
+                    snapshot.gpsY, snapshot.gpsError);
+            }
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char** argv) {
+
+    sim::OdometryGains gains;
+    bool blend = false;
+    const char* tracePrefix = nullptr;
+    std::vector<const char*> logs;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--blend")) blend = true;
+        else if (!strcmp(argv[i], "--k-position") && i + 1 < argc) gains.kPosition = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--k-heading") && i + 1 < argc) gains.kHeading = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--gps-limit") && i + 1 < argc) gains.gpsErrorLimit = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--trace") && i + 1 < argc) tracePrefix = argv[++i];
+        else if (argv[i][0] == '-') logs.clear(), i = argc;
+        else logs.push_back(argv[i]);
+    }
+    if (logs.empty()) {
+        fprintf(stderr, "Usage: %s [--blend [--k-position k] [--k-heading k] [--gps-limit m]] [--trace prefix] "
+            "log.bin...\n", argv[0]);
+        return 1;
+    }
+
+    sim::OdometryFilter blendPrototype;
+    blendPrototype.gains = gains;
+    PoseEKF ekfPrototype;
+    if (blend) {
+        printf("blend filter: k_position %g, k_heading %g, gps limit %g m\n", gains.kPosition, gains.kHeading,
+            gains.gpsErrorLimit);
+    } else {
+        printf("EKF, gps limit %g m\n", ekfPrototype.noise.gpsErrorLimit);
+    }
+    printf("%-32s %8s %8s  %-24s  %-22s\n", "log", "sessions", "updates", "vs recorded rms/max in",
+        "vs gps rms in / deg");
+
+    auto wallStart = std::chrono::steady_clock::now();
+    Metrics total;
+    int failed = 0;
+    double recordedRmsSum = 0, gpsRmsSum = 0, gpsHeadingRmsSum = 0;
+
+    for (const char* path : logs) {
+
+        FILE* trace = nullptr;
+        if (tracePrefix) {
+            std::string name = path;
+            name = name.substr(name.find_last_of('/') + 1);
+            name = name.substr(0, name.rfind('.'));
+            std::string tracePath = std::string(tracePrefix) + name + "_trace.csv";
+            if (!(trace = fopen(tracePath.c_str(), "w"))) {
+                perror(tracePath.c_str());
+                return 1;
+            }
+            fprintf(trace, "time_s,session,x,y,heading,recorded_x,recorded_y,recorded_heading,gps_x,gps_y,gps_error\n");
+        }
+
+        Metrics metrics;
+        bool ok = blend ? replay(path, blendPrototype, gains.gpsErrorLimit, trace, metrics)
+            : replay(path, ekfPrototype, gains.gpsErrorLimit, trace, metrics);
+        if (trace) fclose(trace);
+        if (!ok) {
+            failed++;
+            continue;
+        }
+
+        printf("%-32s %8u %8u  %10.4f %10.4f    %10.3f %10.3f\n", path, metrics.sessions, metrics.updates,
+            metrics.getRecordedRms(), metrics.recordedMax, metrics.getGpsRms(), getDegrees(metrics.getGpsHeadingRms()));
+
+        total.sessions += metrics.sessions;
+        total.updates += metrics.updates;
+        total.recordedMax = fmax(total.recordedMax, metrics.recordedMax);
+        recordedRmsSum += metrics.getRecordedRms();
+        gpsRmsSum += metrics.getGpsRms();
+        gpsHeadingRmsSum += metrics.getGpsHeadingRms();
+    }
+
+    int replayed = logs.size() - failed;
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    if (replayed > 0) {
+        printf("%-32s %8u %8u  %10.4f %10.4f    %10.3f %10.3f\n", "mean over logs", total.sessions, total.updates,
+            recordedRmsSum / replayed, total.recordedMax, gpsRmsSum / replayed, getDegrees(gpsHeadingRmsSum / replayed));
+    }
+    fprintf(stderr, "%d logs replayed, %d failed. %u updates in %.3f s wall time\n", replayed, failed, total.updates,
+        wallSeconds);
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,118 @@
+// Stand-in for the basic PROS ADI API (analog/digital ports) on top of sim::SimAdiPort. Legacy sensors
+// (encoders, ultrasonics, gyros, LEDs) are not simulated
+
+#include <cstddef>
+#include "pros/error.h"
+#include "pros/adi.hpp"
+#include "Simulation/World.h"
+
+using sim::SimAdiPort;
+using sim::World;
+
+namespace {
+
+// Charge the call and run f on the port, or return err if it is out of range
+template <class R, class F>
+R withPort(uint8_t port, bool isWrite, R err, F f) {
+    World& world = World::current();
+    if (isWrite) world.chargeWrite();
+    else world.chargeRead();
+
+    SimAdiPort* adi = world.getAdiPort(port);
+    if (!adi) return err;
+    return f(*adi);
+}
+
+} // namespace
+
+namespace pros {
+namespace c {
+
+adi_port_config_e_t adi_port_get_config(uint8_t port) {
+    return withPort(port, false, E_ADI_ERR, [](SimAdiPort& adi) { return (adi_port_config_e_t) adi.config; });
+}
+
+int32_t adi_port_get_value(uint8_t port) {
+    return withPort(port, false, PROS_ERR, [](SimAdiPort& adi) { return adi.value; });
+}
+
+int32_t adi_port_set_config(uint8_t port, adi_port_config_e_t type) {
+    return withPort(port, true, PROS_ERR, [&](SimAdiPort& adi) {
+        adi.config = type;
+        return 1;
+    });
+}
+
+int32_t adi_port_set_value(uint8_t port, int32_t value) {
+    return withPort(port, true, PROS_ERR, [&](SimAdiPort& adi) {
+        adi.value = value;
+        return 1;
+    });
+}
+
+int32_t adi_analog_calibrate(uint8_t port) {
+    return withPort(port, true, PROS_ERR, [](SimAdiPort& adi) {
+        adi.calibration = adi.value;
+        return adi.calibration;
+    });
+}
+
+int32_t adi_analog_read(uint8_t port) {
+    return adi_port_get_value(port);
+}
+
+int32_t adi_analog_read_calibrated(uint8_t port) {
+    return withPort(port, false, PROS_ERR, [](SimAdiPort& adi) { return adi.value - adi.calibration; });
+}
+
+int32_t adi_analog_read_calibrated_HR(uint8_t port) {
+    return withPort(port, false, PROS_ERR, [](SimAdiPort& adi) { return (adi.value - adi.calibration) * 16; });
+}
+
+int32_t adi_digital_read(uint8_t port) {
+    return withPort(port, false, PROS_ERR, [](SimAdiPort& adi) { return adi.value ? 1 : 0; });
+}
+
+int32_t adi_digital_get_new_press(uint8_t port) {
+    return withPort(port, false, PROS_ERR, [](SimAdiPort& adi) {
+        bool pressed = adi.value != 0;
+        bool newPress = pressed && !adi.lastDigital;
+        adi.lastDigital = pressed;
+        return newPress ? 1 : 0;
+    });
+}
+
+int32_t adi_digital_write(uint8_t port, bool value) {
+    return adi_port_set_value(port, value);
+}
+
+int32_t adi_pin_mode(uint8_t port, uint8_t mode) {
+    return adi_port_set_config(port, (adi_port_config_e_t) mode);
+}
+
+} // namespace c
+
+ADIPort::ADIPort(std::uint8_t adi_port, adi_port_config_e_t type): _smart_port(INTERNAL_ADI_PORT), _adi_port(adi_port) {
+    c::adi_port_set_config(_adi_port, type);
+}
+
+std::int32_t ADIPort::set_config(adi_port_config_e_t type) const { return c::adi_port_set_config(_adi_port, type); }
+std::int32_t ADIPort::get_config() const { return c::adi_port_get_config(_adi_port); }
+std::int32_t ADIPort::set_value(std::int32_t value) const { return c::adi_port_set_value(_adi_port, value); }
+std::int32_t ADIPort::get_value() const { return c::adi_port_get_value(_adi_port); }
+
+ADIAnalogIn::ADIAnalogIn(std::uint8_t adi_port): ADIPort(adi_port, E_ADI_ANALOG_IN) {}
+std::int32_t ADIAnalogIn::calibrate() const { return c::adi_analog_calibrate(_adi_port); }
+std::int32_t ADIAnalogIn::get_value_calibrated() const { return c::adi_analog_read_calibrated(_adi_port); }
+std::int32_t ADIAnalogIn::get_value_calibrated_HR() const { return c::adi_analog_read_calibrated_HR(_adi_port); }
+
+ADIAnalogOut::ADIAnalogOut(std::uint8_t adi_port): ADIPort(adi_port, E_ADI_ANALOG_OUT) {}
+
+ADIDigitalOut::ADIDigitalOut(std::uint8_t adi_port, bool init_state): ADIPort(adi_port, E_ADI_DIGITAL_OUT) {
+    set_value(init_state);
+}
+
+ADIDigitalIn::ADIDigitalIn(std::uint8_t adi_port): ADIPort(adi_port, E_ADI_DIGITAL_IN) {}
+std::int32_t ADIDigitalIn::get_new_press() const { return c::adi_digital_get_new_press(_adi_port); }
+
+} // namespace pros
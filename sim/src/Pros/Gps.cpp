@@ -0,0 +1,145 @@
+// Stand-in for the PROS GPS API on top of sim::SimGps
+
+#include "pros/error.h"
+#include "pros/gps.hpp"
+#include "Simulation/World.h"
+
+using sim::SimGps;
+using sim::World;
+
+namespace {
+
+// Charge the call and run f on the sensor, or return err if the port has no GPS
+template <class R, class F>
+R withGps(uint8_t port, bool isWrite, R err, F f) {
+    World& world = World::current();
+    if (isWrite) world.chargeWrite();
+    else world.chargeRead();
+
+    SimGps* gps = world.getGps(port);
+    if (!gps) return err;
+    return f(*gps);
+}
+
+} // namespace
+
+namespace pros {
+namespace c {
+
+int32_t gps_initialize_full(uint8_t port, double xInitial, double yInitial, double headingInitial, double xOffset,
+                            double yOffset) {
+    if (gps_set_offset(port, xOffset, yOffset) == PROS_ERR) return PROS_ERR;
+    return gps_set_position(port, xInitial, yInitial, headingInitial);
+}
+
+int32_t gps_set_offset(uint8_t port, double xOffset, double yOffset) {
+    return withGps(port, true, PROS_ERR, [&](SimGps& gps) {
+        gps.offsetX = xOffset;
+        gps.offsetY = yOffset;
+        return 1;
+    });
+}
+
+int32_t gps_get_offset(uint8_t port, double* xOffset, double* yOffset) {
+    return withGps(port, false, PROS_ERR, [&](SimGps& gps) {
+        if (xOffset) *xOffset = gps.offsetX;
+        if (yOffset) *yOffset = gps.offsetY;
+        return 1;
+    });
+}
+
+// The real sensor only uses this as a hint until it sees the field strip; here it is taken as the truth
+int32_t gps_set_position(uint8_t port, double xInitial, double yInitial, double headingInitial) {
+    return withGps(port, true, PROS_ERR, [&](SimGps& gps) {
+        gps.x = xInitial;
+        gps.y = yInitial;
+        gps.heading = fmod(fmod(headingInitial, 360) + 360, 360);
+        gps.rotation = headingInitial;
+        return 1;
+    });
+}
+
+int32_t gps_set_data_rate(uint8_t port, uint32_t rate) {
+    return withGps(port, true, PROS_ERR, [&](SimGps& gps) {
+        gps.dataRate = rate < 5 ? 5 : rate - rate % 5;
+        return 1;
+    });
+}
+
+double gps_get_error(uint8_t port) {
+    return withGps(port, false, PROS_ERR_F, [](SimGps& gps) { return gps.error; });
+}
+
+gps_status_s_t gps_get_status(uint8_t port) {
+    gps_status_s_t err = {PROS_ERR_F, PROS_ERR_F, PROS_ERR_F, PROS_ERR_F, PROS_ERR_F};
+    return withGps(port, false, err, [](SimGps& gps) {
+        double yaw = gps.heading > 180 ? gps.heading - 360 : gps.heading;
+        gps_status_s_t status = {gps.x, gps.y, 0, 0, yaw};
+        return status;
+    });
+}
+
+double gps_get_heading(uint8_t port) {
+    return withGps(port, false, PROS_ERR_F, [](SimGps& gps) { return gps.heading; });
+}
+
+double gps_get_heading_raw(uint8_t port) {
+    return withGps(port, false, PROS_ERR_F, [](SimGps& gps) { return gps.rotation; });
+}
+
+double gps_get_rotation(uint8_t port) {
+    return withGps(port, false, PROS_ERR_F, [](SimGps& gps) { return gps.rotation + gps.rotationOffset; });
+}
+
+int32_t gps_set_rotation(uint8_t port, double target) {
+    return withGps(port, true, PROS_ERR, [&](SimGps& gps) {
+        gps.rotationOffset = target - gps.rotation;
+        return 1;
+    });
+}
+
+int32_t gps_tare_rotation(uint8_t port) {
+    return gps_set_rotation(port, 0);
+}
+
+gps_gyro_s_t gps_get_gyro_rate(uint8_t port) {
+    gps_gyro_s_t err = {PROS_ERR_F, PROS_ERR_F, PROS_ERR_F};
+    return withGps(port, false, err, [](SimGps& gps) {
+        gps_gyro_s_t rate = {0, 0, gps.yawRate};
+        return rate;
+    });
+}
+
+gps_accel_s_t gps_get_accel(uint8_t port) {
+    gps_accel_s_t err = {PROS_ERR_F, PROS_ERR_F, PROS_ERR_F};
+    return withGps(port, false, err, [](SimGps& gps) {
+        gps_accel_s_t accel = {0, 0, 1};
+        return accel;
+    });
+}
+
+} // namespace c
+
+std::int32_t Gps::initialize_full(double xInitial, double yInitial, double headingInitial, double xOffset,
+                                  double yOffset) const {
+    return c::gps_initialize_full(_port, xInitial, yInitial, headingInitial, xOffset, yOffset);
+}
+std::int32_t Gps::set_offset(double xOffset, double yOffset) const { return c::gps_set_offset(_port, xOffset, yOffset); }
+std::int32_t Gps::get_offset(double* xOffset, double* yOffset) const {
+    return c::gps_get_offset(_port, xOffset, yOffset);
+}
+std::int32_t Gps::set_position(double xInitial, double yInitial, double headingInitial) const {
+    return c::gps_set_position(_port, xInitial, yInitial, headingInitial);
+}
+std::int32_t Gps::set_data_rate(std::uint32_t rate) const { return c::gps_set_data_rate(_port, rate); }
+double Gps::get_error() const { return c::gps_get_error(_port); }
+pros::c::gps_status_s_t Gps::get_status() const { return c::gps_get_status(_port); }
+double Gps::get_heading() const { return c::gps_get_heading(_port); }
+double Gps::get_heading_raw() const { return c::gps_get_heading_raw(_port); }
+double Gps::get_rotation() const { return c::gps_get_rotation(_port); }
+std::int32_t Gps::set_rotation(double target) const { return c::gps_set_rotation(_port, target); }
+std::int32_t Gps::tare_rotation() const { return c::gps_tare_rotation(_port); }
+pros::c::gps_gyro_s_t Gps::get_gyro_rate() const { return c::gps_get_gyro_rate(_port); }
+pros::c::gps_accel_s_t Gps::get_accel() const { return c::gps_get_accel(_port); }
+
+} // namespace pros
@@ -0,0 +1,253 @@
+// Stand-in for the PROS inertial sensor API on top of sim::SimImu
+
+#include "pros/error.h"
+#include "pros/imu.hpp"
+#include "Simulation/World.h"
+#include <errno.h>
+
+using sim::SimImu;
+using sim::World;
+
+namespace {
+
+double wrap180(double degrees) {
+    return fmod(fmod(degrees + 180, 360) + 360, 360) - 180;
+}
+
+// Charge the call and run f on the sensor, or return err if it is missing or still calibrating
+template <class R, class F>
+R withImu(uint8_t port, bool isWrite, R err, F f) {
+    World& world = World::current();
+    if (isWrite) world.chargeWrite();
+    else world.chargeRead();
+
+    SimImu* imu = world.getImu(port);
+    if (!imu) return err;
+    if (imu->isCalibrating(world.getTime())) {
+        errno = EAGAIN;
+        return err;
+    }
+    return f(*imu);
+}
+
+} // namespace
+
+namespace pros {
+namespace c {
+
+int32_t imu_reset(uint8_t port) {
+    World& world = World::current();
+    world.chargeWrite();
+
+    SimImu* imu = world.getImu(port);
+    if (!imu) return PROS_ERR;
+    if (imu->isCalibrating(world.getTime())) {
+        errno = EAGAIN;
+        return PROS_ERR;
+    }
+
+    imu->calibrationEnd = world.getTime() + SimImu::CALIBRATION_MICROS;
+    // Calibration zeroes every reading at the current orientation
+    imu->headingOffset = imu->rotationOffset = imu->yawOffset = -imu->getMeasuredYaw();
+    imu->pitchOffset = -imu->pitch;
+    imu->rollOffset = -imu->roll;
+    return 1;
+}
+
+int32_t imu_reset_blocking(uint8_t port) {
+    if (imu_reset(port) == PROS_ERR) return PROS_ERR;
+
+    World& world = World::current();
+    world.scheduler.sleepUntil(world.getImu(port)->calibrationEnd);
+    return 1;
+}
+
+int32_t imu_set_data_rate(uint8_t port, uint32_t rate) {
+    return withImu(port, true, PROS_ERR, [&](SimImu& imu) {
+        imu.dataRate = rate < IMU_MINIMUM_DATA_RATE ? IMU_MINIMUM_DATA_RATE : rate - rate % 5;
+        return 1;
+    });
+}
+
+double imu_get_rotation(uint8_t port) {
+    return withImu(port, false, PROS_ERR_F, [](SimImu& imu) {
+        return imu.getRotation() + World::current().gaussian(imu.noise);
+    });
+}
+
+double imu_get_heading(uint8_t port) {
+    return withImu(port, false, PROS_ERR_F, [](SimImu& imu) {
+        double heading = imu.getHeading() + World::current().gaussian(imu.noise);
+        return fmod(heading + 360, 360);
+    });
+}
+
+euler_s_t imu_get_euler(uint8_t port) {
+    euler_s_t err = {PROS_ERR_F, PROS_ERR_F, PROS_ERR_F};
+    return withImu(port, false, err, [](SimImu& imu) {
+        euler_s_t euler = {imu.pitch + imu.pitchOffset, imu.roll + imu.rollOffset, wrap180(imu.getMeasuredYaw() + imu.yawOffset)};
+        return euler;
+    });
+}
+
+quaternion_s_t imu_get_quaternion(uint8_t port) {
+    quaternion_s_t err = {PROS_ERR_F, PROS_ERR_F, PROS_ERR_F, PROS_ERR_F};
+    euler_s_t euler = imu_get_euler(port);
+    if (euler.yaw == PROS_ERR_F) return err;
+
+    double cy = cos(-euler.yaw * M_PI / 360), sy = sin(-euler.yaw * M_PI / 360);
+    double cp = cos(euler.pitch * M_PI / 360), sp = sin(euler.pitch * M_PI / 360);
+    double cr = cos(euler.roll * M_PI / 360), sr = sin(euler.roll * M_PI / 360);
+
+    quaternion_s_t q;
+    q.w = cr * cp * cy + sr * sp * sy;
+    q.x = sr * cp * cy - cr * sp * sy;
+    q.y = cr * sp * cy + sr * cp * sy;
+    q.z = cr * cp * sy - sr * sp * cy;
+    return q;
+}
+
+double imu_get_pitch(uint8_t port) {
+    return imu_get_euler(port).pitch;
+}
+
+double imu_get_roll(uint8_t port) {
+    return imu_get_euler(port).roll;
+}
+
+double imu_get_yaw(uint8_t port) {
+    return imu_get_euler(port).yaw;
+}
+
+imu_gyro_s_t imu_get_gyro_rate(uint8_t port) {
+    imu_gyro_s_t err = {PROS_ERR_F, PROS_ERR_F, PROS_ERR_F};
+    return withImu(port, false, err, [](SimImu& imu) {
+        imu_gyro_s_t rate = {0, 0, imu.yawRate};
+        return rate;
+    });
+}
+
+imu_accel_s_t imu_get_accel(uint8_t port) {
+    imu_accel_s_t err = {PROS_ERR_F, PROS_ERR_F, PROS_ERR_F};
+    return withImu(port, false, err, [](SimImu& imu) {
+        imu_accel_s_t accel = {0, 0, 1};
+        return accel;
+    });
+}
+
+imu_status_e_t imu_get_status(uint8_t port) {
+    World& world = World::current();
+    world.chargeRead();
+
+    SimImu* imu = world.getImu(port);
+    if (!imu) return E_IMU_STATUS_ERROR;
+    return imu->isCalibrating(world.getTime()) ? E_IMU_STATUS_CALIBRATING : (imu_status_e_t) 0;
+}
+
+int32_t imu_tare_heading(uint8_t port) {
+    return imu_set_heading(port, 0);
+}
+
+int32_t imu_tare_rotation(uint8_t port) {
+    return imu_set_rotation(port, 0);
+}
+
+int32_t imu_tare_pitch(uint8_t port) {
+    return imu_set_pitch(port, 0);
+}
+
+int32_t imu_tare_roll(uint8_t port) {
+    return imu_set_roll(port, 0);
+}
+
+int32_t imu_tare_yaw(uint8_t port) {
+    return imu_set_yaw(port, 0);
+}
+
+int32_t imu_tare_euler(uint8_t port) {
+    euler_s_t zero = {0, 0, 0};
+    return imu_set_euler(port, zero);
+}
+
+int32_t imu_tare(uint8_t port) {
+    if (imu_tare_euler(port) == PROS_ERR) return PROS_ERR;
+    if (imu_tare_rotation(port) == PROS_ERR) return PROS_ERR;
+    return imu_tare_heading(port);
+}
+
+int32_t imu_set_euler(uint8_t port, euler_s_t target) {
+    return withImu(port, true, PROS_ERR, [&](SimImu& imu) {
+        imu.pitchOffset = target.pitch - imu.pitch;
+        imu.rollOffset = target.roll - imu.roll;
+        imu.yawOffset = target.yaw - imu.getMeasuredYaw();
+        return 1;
+    });
+}
+
+int32_t imu_set_rotation(uint8_t port, double target) {
+    return withImu(port, true, PROS_ERR, [&](SimImu& imu) {
+        imu.rotationOffset = target - imu.getMeasuredYaw();
+        return 1;
+    });
+}
+
+int32_t imu_set_heading(uint8_t port, double target) {
+    return withImu(port, true, PROS_ERR, [&](SimImu& imu) {
+        imu.headingOffset = target - imu.getMeasuredYaw();
+        return 1;
+    });
+}
+
+int32_t imu_set_pitch(uint8_t port, double target) {
+    return withImu(port, true, PROS_ERR, [&](SimImu& imu) {
+        imu.pitchOffset = target - imu.pitch;
+        return 1;
+    });
+}
+
+int32_t imu_set_roll(uint8_t port, double target) {
+    return withImu(port, true, PROS_ERR, [&](SimImu& imu) {
+        imu.rollOffset = target - imu.roll;
+        return 1;
+    });
+}
+
+int32_t imu_set_yaw(uint8_t port, double target) {
+    return withImu(port, true, PROS_ERR, [&](SimImu& imu) {
+        imu.yawOffset = target - imu.getMeasuredYaw();
+        return 1;
+    });
+}
+
+} // namespace c
+
+std::int32_t Imu::reset(bool blocking) const {
+    return blocking ? c::imu_reset_blocking(_port) : c::imu_reset(_port);
+}
+std::int32_t Imu::set_data_rate(std::uint32_t rate) const { return c::imu_set_data_rate(_port, rate); }
+double Imu::get_rotation() const { return c::imu_get_rotation(_port); }
+double Imu::get_heading() const { return c::imu_get_heading(_port); }
+pros::c::quaternion_s_t Imu::get_quaternion() const { return c::imu_get_quaternion(_port); }
+pros::c::euler_s_t Imu::get_euler() const { return c::imu_get_euler(_port); }
+double Imu::get_pitch() const { return c::imu_get_pitch(_port); }
+double Imu::get_roll() const { return c::imu_get_roll(_port); }
+double Imu::get_yaw() const { return c::imu_get_yaw(_port); }
+pros::c::imu_gyro_s_t Imu::get_gyro_rate() const { return c::imu_get_gyro_rate(_port); }
+std::int32_t Imu::tare_rotation() const { return c::imu_tare_rotation(_port); }
+std::int32_t Imu::tare_heading() const { return c::imu_tare_heading(_port); }
+std::int32_t Imu::tare_pitch() const { return c::imu_tare_pitch(_port); }
+std::int32_t Imu::tare_yaw() const { return c::imu_tare_yaw(_port); }
+std::int32_t Imu::tare_roll() const { return c::imu_tare_roll(_port); }
+std::int32_t Imu::tare() const { return c::imu_tare(_port); }
+std::int32_t Imu::tare_euler() const { return c::imu_tare_euler(_port); }
+std::int32_t Imu::set_heading(const double target) const { return c::imu_set_heading(_port, target); }
+std::int32_t Imu::set_rotation(const double target) const { return c::imu_set_rotation(_port, target); }
+std::int32_t Imu::set_yaw(const double target) const { return c::imu_set_yaw(_port, target); }
+std::int32_t Imu::set_pitch(const double target) const { return c::imu_set_pitch(_port, target); }
+std::int32_t Imu::set_roll(const double target) const { return c::imu_set_roll(_port, target); }
+std::int32_t Imu::set_euler(const pros::c::euler_s_t target) const { return c::imu_set_euler(_port, target); }
+pros::c::imu_accel_s_t Imu::get_accel() const { return c::imu_get_accel(_port); }
+pros::c::imu_status_e_t Imu::get_status() const { return c::imu_get_status(_port); }
+bool Imu::is_calibrating() const { return get_status() & c::E_IMU_STATUS_CALIBRATING; }
+
+} // namespace pros
@@ -0,0 +1,135 @@
+// Stand-in for the PROS LLEMU (emulated three button LCD). Text is kept so programs can inspect it
+
+#include "pros/error.h"
+#include "pros/llemu.hpp"
+#include "Simulation/World.h"
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+using sim::SimDisplay;
+using sim::World;
+
+namespace {
+
+SimDisplay* getDisplay(uint32_t cost) {
+    World& world = World::current();
+    world.stats.lcdCalls++;
+    world.charge(cost);
+
+    if (!world.display.lcdInitialized) {
+        errno = ENXIO;
+        return nullptr;
+    }
+    return &world.display;
+}
+
+bool isLine(int16_t line) {
+    if (line < 0 || line > 7) {
+        errno = EINVAL;
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+namespace pros {
+namespace c {
+
+bool lcd_is_initialized(void) {
+    return World::current().display.lcdInitialized;
+}
+
+bool lcd_initialize(void) {
+    SimDisplay& display = World::current().display;
+    if (display.lcdInitialized) return false;
+
+    display = SimDisplay();
+    display.lcdInitialized = true;
+    return true;
+}
+
+bool lcd_shutdown(void) {
+    SimDisplay& display = World::current().display;
+    if (!display.lcdInitialized) return false;
+
+    display.lcdInitialized = false;
+    return true;
+}
+
+bool lcd_set_text(int16_t line, const char* text) {
+    SimDisplay* display = getDisplay(World::current().costs.lcdPrint);
+    if (!display || !isLine(line)) return false;
+
+    display->lines[line] = text;
+    return true;
+}
+
+bool lcd_print(int16_t line, const char* fmt, ...) {
+    char buffer[64];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buffer, sizeof(buffer), fmt, args);
+    va_end(args);
+    return lcd_set_text(line, buffer);
+}
+
+bool lcd_clear(void) {
+    SimDisplay* display = getDisplay(World::current().costs.lcdClear);
+    if (!display) return false;
+
+    for (std::string& line : display->lines) line.clear();
+    return true;
+}
+
+bool lcd_clear_line(int16_t line) {
+    SimDisplay* display = getDisplay(World::current().costs.lcdPrint);
+    if (!display || !isLine(line)) return false;
+
+    display->lines[line].clear();
+    return true;
+}
+
+static bool registerButton(int index, lcd_btn_cb_fn_t cb) {
+    SimDisplay* display = getDisplay(0);
+    if (!display) return false;
+
+    display->buttonCallbacks[index] = cb;
+    return true;
+}
+
+bool lcd_register_btn0_cb(lcd_btn_cb_fn_t cb) {
+    return registerButton(0, cb);
+}
+
+bool lcd_register_btn1_cb(lcd_btn_cb_fn_t cb) {
+    return registerButton(1, cb);
+}
+
+bool lcd_register_btn2_cb(lcd_btn_cb_fn_t cb) {
+    return registerButton(2, cb);
+}
+
+uint8_t lcd_read_buttons(void) {
+    SimDisplay* display = getDisplay(0);
+    return display ? display->buttons : 0;
+}
+
+} // namespace c
+
+namespace lcd {
+
+bool is_initialized(void) { return c::lcd_is_initialized(); }
+bool initialize(void) { return c::lcd_initialize(); }
+bool shutdown(void) { return c::lcd_shutdown(); }
+bool set_text(std::int16_t line, std::string text) { return c::lcd_set_text(line, text.c_str()); }
+bool clear(void) { return c::lcd_clear(); }
+bool clear_line(std::int16_t line) { return c::lcd_clear_line(line); }
+void register_btn0_cb(lcd_btn_cb_fn_t cb) { c::lcd_register_btn0_cb(cb); }
+void register_btn1_cb(lcd_btn_cb_fn_t cb) { c::lcd_register_btn1_cb(cb); }
+void register_btn2_cb(lcd_btn_cb_fn_t cb) { c::lcd_register_btn2_cb(cb); }
+std::uint8_t read_buttons(void) { return c::lcd_read_buttons(); }
+
+} // namespace lcd
+} // namespace pros
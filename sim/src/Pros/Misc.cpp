@@ -0,0 +1,176 @@
+// Stand-in for the PROS controller, battery, competition and SD card API
+
+#include "pros/error.h"
+#include "pros/misc.hpp"
+#include "Simulation/World.h"
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+using sim::SimController;
+using sim::World;
+
+namespace {
+
+SimController* getController(pros::controller_id_e_t id) {
+    World& world = World::current();
+    world.chargeRead();
+
+    if (id != pros::E_CONTROLLER_MASTER && id != pros::E_CONTROLLER_PARTNER) {
+        errno = EINVAL;
+        return nullptr;
+    }
+    return &world.controllers[id];
+}
+
+bool isButton(pros::controller_digital_e_t button) {
+    return button >= pros::E_CONTROLLER_DIGITAL_L1 && button <= pros::E_CONTROLLER_DIGITAL_A;
+}
+
+} // namespace
+
+namespace pros {
+namespace c {
+
+uint8_t competition_get_status(void) {
+    return World::current().competitionStatus;
+}
+
+int32_t controller_is_connected(controller_id_e_t id) {
+    SimController* controller = getController(id);
+    if (!controller) return PROS_ERR;
+    return controller->connected ? 1 : 0;
+}
+
+int32_t controller_get_analog(controller_id_e_t id, controller_analog_e_t channel) {
+    SimController* controller = getController(id);
+    if (!controller || channel < E_CONTROLLER_ANALOG_LEFT_X || channel > E_CONTROLLER_ANALOG_RIGHT_Y) return 0;
+    return controller->connected ? controller->analog[channel] : 0;
+}
+
+int32_t controller_get_battery_capacity(controller_id_e_t id) {
+    SimController* controller = getController(id);
+    if (!controller) return PROS_ERR;
+    return controller->battery;
+}
+
+int32_t controller_get_battery_level(controller_id_e_t id) {
+    return controller_get_battery_capacity(id);
+}
+
+int32_t controller_get_digital(controller_id_e_t id, controller_digital_e_t button) {
+    SimController* controller = getController(id);
+    if (!controller || !isButton(button)) return 0;
+    return controller->connected && controller->digital[button - E_CONTROLLER_DIGITAL_L1] ? 1 : 0;
+}
+
+int32_t controller_get_digital_new_press(controller_id_e_t id, controller_digital_e_t button) {
+    SimController* controller = getController(id);
+    if (!controller || !isButton(button)) return 0;
+
+    int index = button - E_CONTROLLER_DIGITAL_L1;
+    bool pressed = controller->connected && controller->digital[index];
+    bool newPress = pressed && !controller->lastDigital[index];
+    controller->lastDigital[index] = pressed;
+    return newPress ? 1 : 0;
+}
+
+int32_t controller_set_text(controller_id_e_t id, uint8_t line, uint8_t col, const char* str) {
+    SimController* controller = getController(id);
+    if (!controller || line > 2) return PROS_ERR;
+
+    std::string& text = controller->lines[line];
+    if (text.size() < col) text.resize(col, ' ');
+    text.replace(col, std::string::npos, str);
+    return 1;
+}
+
+int32_t controller_print(controller_id_e_t id, uint8_t line, uint8_t col, const char* fmt, ...) {
+    char buffer[32];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buffer, sizeof(buffer), fmt, args);
+    va_end(args);
+    return controller_set_text(id, line, col, buffer);
+}
+
+int32_t controller_clear_line(controller_id_e_t id, uint8_t line) {
+    SimController* controller = getController(id);
+    if (!controller || line > 2) return PROS_ERR;
+    controller->lines[line].clear();
+    return 1;
+}
+
+int32_t controller_clear(controller_id_e_t id) {
+    SimController* controller = getController(id);
+    if (!controller) return PROS_ERR;
+    for (std::string& line : controller->lines) line.clear();
+    return 1;
+}
+
+int32_t controller_rumble(controller_id_e_t id, const char* rumble_pattern) {
+    return getController(id) ? 1 : PROS_ERR;
+}
+
+int32_t battery_get_voltage(void) {
+    return (int32_t) (World::current().batteryVoltage * 1000);
+}
+
+int32_t battery_get_current(void) {
+    double current = 0;
+    for (sim::SimMotor* motor : World::current().getMotors()) current += fabs(motor->current);
+    return (int32_t) (current * 1000);
+}
+
+double battery_get_temperature(void) {
+    return 25;
+}
+
+double battery_get_capacity(void) {
+    return 100;
+}
+
+int32_t usd_is_installed(void) {
+    return World::current().sdCardInstalled ? 1 : 0;
+}
+
+} // namespace c
+
+Controller::Controller(controller_id_e_t id): _id(id) {}
+std::int32_t Controller::is_connected(void) { return c::controller_is_connected(_id); }
+std::int32_t Controller::get_analog(controller_analog_e_t channel) { return c::controller_get_analog(_id, channel); }
+std::int32_t Controller::get_battery_capacity(void) { return c::controller_get_battery_capacity(_id); }
+std::int32_t Controller::get_battery_level(void) { return c::controller_get_battery_level(_id); }
+std::int32_t Controller::get_digital(controller_digital_e_t button) { return c::controller_get_digital(_id, button); }
+std::int32_t Controller::get_digital_new_press(controller_digital_e_t button) {
+    return c::controller_get_digital_new_press(_id, button);
+}
+std::int32_t Controller::set_text(std::uint8_t line, std::uint8_t col, const char* str) {
+    return c::controller_set_text(_id, line, col, str);
+}
+std::int32_t Controller::set_text(std::uint8_t line, std::uint8_t col, const std::string& str) {
+    return c::controller_set_text(_id, line, col, str.c_str());
+}
+std::int32_t Controller::clear_line(std::uint8_t line) { return c::controller_clear_line(_id, line); }
+std::int32_t Controller::rumble(const char* rumble_pattern) { return c::controller_rumble(_id, rumble_pattern); }
+std::int32_t Controller::clear(void) { return c::controller_clear(_id); }
+
+namespace battery {
+double get_capacity(void) { return c::battery_get_capacity(); }
+int32_t get_current(void) { return c::battery_get_current(); }
+double get_temperature(void) { return c::battery_get_temperature(); }
+int32_t get_voltage(void) { return c::battery_get_voltage(); }
+} // namespace battery
+
+namespace competition {
+std::uint8_t get_status(void) { return c::competition_get_status(); }
+std::uint8_t is_autonomous(void) { return (c::competition_get_status() & COMPETITION_AUTONOMOUS) != 0; }
+std::uint8_t is_connected(void) { return (c::competition_get_status() & COMPETITION_CONNECTED) != 0; }
+std::uint8_t is_disabled(void) { return (c::competition_get_status() & COMPETITION_DISABLED) != 0; }
+} // namespace competition
+
+namespace usd {
+std::int32_t is_installed(void) { return c::usd_is_installed(); }
+} // namespace usd
+
+} // namespace pros
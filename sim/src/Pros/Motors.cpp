@@ -0,0 +1,598 @@
+// Stand-in for the PROS motor API on top of sim::SimMotor
+
+#include "pros/error.h"
+#include "pros/motors.hpp"
+#include "Simulation/World.h"
+#include <cstdlib>
+
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+
+using sim::SimMotor;
+using sim::World;
+
+namespace {
+
+constexpr double RPM_TO_RAD_PER_SEC = 2 * M_PI / 60;
+
+// Charge the call to the running task and run f on the motor, or return err if the port has no motor
+template <class R, class F>
+R withMotor(uint8_t port, bool isWrite, R err, F f) {
+    World& world = World::current();
+    if (isWrite) world.chargeWrite();
+    else world.chargeRead();
+
+    SimMotor* motor = world.getMotor(port);
+    if (!motor) return err;
+    return f(*motor);
+}
+
+} // namespace
+
+namespace pros {
+namespace c {
+
+int32_t motor_move(uint8_t port, int32_t voltage) {
+    return motor_move_voltage(port, voltage * 12000 / 127);
+}
+
+int32_t motor_brake(uint8_t port) {
+    return withMotor(port, true, PROS_ERR, [](SimMotor& m) {
+        m.mode = SimMotor::Mode::BRAKE;
+        return 1;
+    });
+}
+
+int32_t motor_move_absolute(uint8_t port, const double position, const int32_t velocity) {
+    return withMotor(port, true, PROS_ERR, [&](SimMotor& m) {
+        m.mode = SimMotor::Mode::POSITION;
+        m.targetAngle = m.zeroAngle + m.direction() * m.fromUnits(position);
+        m.profileVelocity = std::abs(velocity) * RPM_TO_RAD_PER_SEC;
+        return 1;
+    });
+}
+
+int32_t motor_move_relative(uint8_t port, const double position, const int32_t velocity) {
+    return withMotor(port, true, PROS_ERR, [&](SimMotor& m) {
+        m.mode = SimMotor::Mode::POSITION;
+        m.targetAngle = m.angle + m.direction() * m.fromUnits(position);
+        m.profileVelocity = std::abs(velocity) * RPM_TO_RAD_PER_SEC;
+        return 1;
+    });
+}
+
+int32_t motor_move_velocity(uint8_t port, const int32_t velocity) {
+    return withMotor(port, true, PROS_ERR, [&](SimMotor& m) {
+        m.mode = SimMotor::Mode::VELOCITY;
+        m.targetVelocity = m.direction() * velocity * RPM_TO_RAD_PER_SEC;
+        return 1;
+    });
+}
+
+int32_t motor_move_voltage(uint8_t port, const int32_t voltage) {
+    return withMotor(port, true, PROS_ERR, [&](SimMotor& m) {
+        m.mode = SimMotor::Mode::VOLTAGE;
+        m.targetVoltage = m.direction() * fmax(-12000, fmin(12000, voltage)) / 1000.0;
+        m.voltageCommands++;
+        return 1;
+    });
+}
+
+int32_t motor_modify_profiled_velocity(uint8_t port, const int32_t velocity) {
+    return withMotor(port, true, PROS_ERR, [&](SimMotor& m) {
+        m.profileVelocity = std::abs(velocity) * RPM_TO_RAD_PER_SEC;
+        return 1;
+    });
+}
+
+double motor_get_target_position(uint8_t port) {
+    return withMotor(port, false, PROS_ERR_F, [](SimMotor& m) {
+        return m.direction() * m.toUnits(m.targetAngle - m.zeroAngle);
+    });
+}
+
+int32_t motor_get_target_velocity(uint8_t port) {
+    return withMotor(port, false, PROS_ERR, [](SimMotor& m) {
+        return (int32_t) (m.direction() * m.targetVelocity / RPM_TO_RAD_PER_SEC);
+    });
+}
+
+double motor_get_actual_velocity(uint8_t port) {
+    return withMotor(port, false, PROS_ERR_F, [](SimMotor& m) {
+        return m.direction() * m.velocity / RPM_TO_RAD_PER_SEC + World::current().gaussian(m.velocityNoise);
+    });
+}
+
+int32_t motor_get_current_draw(uint8_t port) {
+    return withMotor(port, false, PROS_ERR, [](SimMotor& m) {
+        return (int32_t) (fabs(m.current) * 1000);
+    });
+}
+
+int32_t motor_get_direction(uint8_t port) {
+    return withMotor(port, false, PROS_ERR, [](SimMotor& m) {
+        return m.direction() * m.velocity < 0 ? -1 : 1;
+    });
+}
+
+double motor_get_efficiency(uint8_t port) {
+    return withMotor(port, false, PROS_ERR_F, [](SimMotor& m) {
+        double input = fabs(m.appliedVoltage * m.current);
+        if (input < 1e-6) return 0.0;
+        return fmin(100.0, 100 * fabs(m.torque * m.velocity) / input);
+    });
+}
+
+int32_t motor_is_over_current(uint8_t port) {
+    return withMotor(port, false, PROS_ERR, [](SimMotor& m) {
+        return fabs(m.current) * 1000 >= m.currentLimit ? 1 : 0;
+    });
+}
+
+int32_t motor_is_over_temp(uint8_t port) {
+    return withMotor(port, false, PROS_ERR, [](SimMotor& m) {
+        return m.temperature >= 55 ? 1 : 0;
+    });
+}
+
+int32_t motor_is_stopped(uint8_t port) {
+    return withMotor(port, false, PROS_ERR, [](SimMotor& m) {
+        return fabs(m.velocity) < 0.01 ? 1 : 0;
+    });
+}
+
+int32_t motor_get_zero_position_flag(uint8_t port) {
+    return withMotor(port, false, PROS_ERR, [](SimMotor& m) {
+        return fabs(m.angle - m.zeroAngle) < 1e-3 ? 1 : 0;
+    });
+}
+
+uint32_t motor_get_faults(uint8_t port) {
+    return withMotor(port, false, (uint32_t) PROS_ERR, [](SimMotor& m) {
+        uint32_t faults = E_MOTOR_FAULT_NO_FAULTS;
+        if (m.temperature >= 55) faults |= E_MOTOR_FAULT_MOTOR_OVER_TEMP;
+        if (fabs(m.current) * 1000 >= m.currentLimit) faults |= E_MOTOR_FAULT_OVER_CURRENT;
+        return faults;
+    });
+}
+
+uint32_t motor_get_flags(uint8_t port) {
+    return withMotor(port, false, (uint32_t) PROS_ERR, [](SimMotor& m) {
+        uint32_t flags = E_MOTOR_FLAGS_NONE;
+        if (fabs(m.velocity) < 0.01) flags |= E_MOTOR_FLAGS_ZERO_VELOCITY;
+        if (fabs(m.angle - m.zeroAngle) < 1e-3) flags |= E_MOTOR_FLAGS_ZERO_POSITION;
+        return flags;
+    });
+}
+
+int32_t motor_get_raw_position(uint8_t port, uint32_t* const timestamp) {
+    return withMotor(port, false, PROS_ERR, [&](SimMotor& m) {
+        if (timestamp) *timestamp = millis();
+        return (int32_t) (m.direction() * m.angle / (2 * M_PI) * m.getTicksPerRevolution());
+    });
+}
+
+double motor_get_position(uint8_t port) {
+    return withMotor(port, false, PROS_ERR_F, [](SimMotor& m) {
+        return m.direction() * m.toUnits(m.angle - m.zeroAngle);
+    });
+}
+
+double motor_get_power(uint8_t port) {
+    return withMotor(port, false, PROS_ERR_F, [](SimMotor& m) {
+        return fabs(m.appliedVoltage * m.current);
+    });
+}
+
+double motor_get_temperature(uint8_t port) {
+    return withMotor(port, false, PROS_ERR_F, [](SimMotor& m) {
+        return m.temperature;
+    });
+}
+
+double motor_get_torque(uint8_t port) {
+    return withMotor(port, false, PROS_ERR_F, [](SimMotor& m) {
+        return m.direction() * m.torque;
+    });
+}
+
+int32_t motor_get_voltage(uint8_t port) {
+    return withMotor(port, false, PROS_ERR, [](SimMotor& m) {
+        return (int32_t) (m.direction() * m.appliedVoltage * 1000);
+    });
+}
+
+int32_t motor_set_zero_position(uint8_t port, const double position) {
+    return withMotor(port, true, PROS_ERR, [&](SimMotor& m) {
+        m.zeroAngle += m.direction() * m.fromUnits(position);
+        return 1;
+    });
+}
+
+int32_t motor_tare_position(uint8_t port) {
+    return withMotor(port, true, PROS_ERR, [](SimMotor& m) {
+        m.zeroAngle = m.angle;
+        return 1;
+    });
+}
+
+int32_t motor_set_brake_mode(uint8_t port, const motor_brake_mode_e_t mode) {
+    return withMotor(port, true, PROS_ERR, [&](SimMotor& m) {
+        m.brakeMode = mode;
+        return 1;
+    });
+}
+
+int32_t motor_set_current_limit(uint8_t port, const int32_t limit) {
+    return withMotor(port, true, PROS_ERR, [&](SimMotor& m) {
+        m.currentLimit = limit;
+        return 1;
+    });
+}
+
+int32_t motor_set_encoder_units(uint8_t port, const motor_encoder_units_e_t units) {
+    return withMotor(port, true, PROS_ERR, [&](SimMotor& m) {
+        m.units = units;
+        return 1;
+    });
+}
+
+int32_t motor_set_gearing(uint8_t port, const motor_gearset_e_t gearset) {
+    return withMotor(port, true, PROS_ERR, [&](SimMotor& m) {
+        m.gearset = gearset;
+        return 1;
+    });
+}
+
+// The simulated firmware ignores custom PID constants, like a motor that has been power cycled
+motor_pid_s_t motor_convert_pid(double kf, double kp, double ki, double kd) {
+    return {(uint8_t) kf, (uint8_t) kp, (uint8_t) ki, (uint8_t) kd};
+}
+
+motor_pid_full_s_t motor_convert_pid_full(double kf, double kp, double ki, double kd, double filter, double limit,
+                                          double threshold, double loopspeed) {
+    return {(uint8_t) kf, (uint8_t) kp, (uint8_t) ki, (uint8_t) kd, (uint8_t) filter, (uint16_t) limit,
+            (uint8_t) threshold, (uint8_t) loopspeed};
+}
+
+int32_t motor_set_pos_pid(uint8_t port, const motor_pid_s_t pid) {
+    return withMotor(port, true, PROS_ERR, [](SimMotor& m) { return 1; });
+}
+
+int32_t motor_set_pos_pid_full(uint8_t port, const motor_pid_full_s_t pid) {
+    return withMotor(port, true, PROS_ERR, [](SimMotor& m) { return 1; });
+}
+
+int32_t motor_set_vel_pid(uint8_t port, const motor_pid_s_t pid) {
+    return withMotor(port, true, PROS_ERR, [](SimMotor& m) { return 1; });
+}
+
+int32_t motor_set_vel_pid_full(uint8_t port, const motor_pid_full_s_t pid) {
+    return withMotor(port, true, PROS_ERR, [](SimMotor& m) { return 1; });
+}
+
+int32_t motor_set_reversed(uint8_t port, const bool reverse) {
+    return withMotor(port, true, PROS_ERR, [&](SimMotor& m) {
+        m.reversed = reverse;
+        return 1;
+    });
+}
+
+int32_t motor_set_voltage_limit(uint8_t port, const int32_t limit) {
+    return withMotor(port, true, PROS_ERR, [&](SimMotor& m) {
+        m.voltageLimit = limit;
+        return 1;
+    });
+}
+
+motor_brake_mode_e_t motor_get_brake_mode(uint8_t port) {
+    return withMotor(port, false, E_MOTOR_BRAKE_INVALID, [](SimMotor& m) { return m.brakeMode; });
+}
+
+int32_t motor_get_current_limit(uint8_t port) {
+    return withMotor(port, false, PROS_ERR, [](SimMotor& m) { return m.currentLimit; });
+}
+
+motor_encoder_units_e_t motor_get_encoder_units(uint8_t port) {
+    return withMotor(port, false, E_MOTOR_ENCODER_INVALID, [](SimMotor& m) { return m.units; });
+}
+
+motor_gearset_e_t motor_get_gearing(uint8_t port) {
+    return withMotor(port, false, E_MOTOR_GEARSET_INVALID, [](SimMotor& m) { return m.gearset; });
+}
+
+motor_pid_full_s_t motor_get_pos_pid(uint8_t port) {
+    return motor_convert_pid_full(0, 0, 0, 0, 0, 0, 0, 0);
+}
+
+motor_pid_full_s_t motor_get_vel_pid(uint8_t port) {
+    return motor_convert_pid_full(0, 0, 0, 0, 0, 0, 0, 0);
+}
+
+int32_t motor_is_reversed(uint8_t port) {
+    return withMotor(port, false, PROS_ERR, [](SimMotor& m) { return m.reversed ? 1 : 0; });
+}
+
+int32_t motor_get_voltage_limit(uint8_t port) {
+    return withMotor(port, false, PROS_ERR, [](SimMotor& m) { return m.voltageLimit; });
+}
+
+} // namespace c
+
+Motor::Motor(const std::int8_t port, const motor_gearset_e_t gearset, const bool reverse,
+             const motor_encoder_units_e_t encoder_units): _port(std::abs(port)) {
+    set_gearing(gearset);
+    set_reversed(reverse != (port < 0));
+    set_encoder_units(encoder_units);
+}
+
+Motor::Motor(const std::int8_t port, const motor_gearset_e_t gearset, const bool reverse): _port(std::abs(port)) {
+    set_gearing(gearset);
+    set_reversed(reverse != (port < 0));
+}
+
+Motor::Motor(const std::int8_t port, const motor_gearset_e_t gearset): _port(std::abs(port)) {
+    set_gearing(gearset);
+    set_reversed(port < 0);
+}
+
+Motor::Motor(const std::int8_t port, const bool reverse): _port(std::abs(port)) {
+    set_reversed(reverse != (port < 0));
+}
+
+Motor::Motor(const std::int8_t port): _port(std::abs(port)) {
+    if (port < 0) set_reversed(true);
+}
+
+std::int32_t Motor::operator=(std::int32_t voltage) const { return c::motor_move(_port, voltage); }
+std::int32_t Motor::move(std::int32_t voltage) const { return c::motor_move(_port, voltage); }
+std::int32_t Motor::move_absolute(const double position, const std::int32_t velocity) const {
+    return c::motor_move_absolute(_port, position, velocity);
+}
+std::int32_t Motor::move_relative(const double position, const std::int32_t velocity) const {
+    return c::motor_move_relative(_port, position, velocity);
+}
+std::int32_t Motor::move_velocity(const std::int32_t velocity) const { return c::motor_move_velocity(_port, velocity); }
+std::int32_t Motor::move_voltage(const std::int32_t voltage) const { return c::motor_move_voltage(_port, voltage); }
+std::int32_t Motor::brake(void) const { return c::motor_brake(_port); }
+std::int32_t Motor::modify_profiled_velocity(const std::int32_t velocity) const {
+    return c::motor_modify_profiled_velocity(_port, velocity);
+}
+double Motor::get_target_position(void) const { return c::motor_get_target_position(_port); }
+std::int32_t Motor::get_target_velocity(void) const { return c::motor_get_target_velocity(_port); }
+double Motor::get_actual_velocity(void) const { return c::motor_get_actual_velocity(_port); }
+std::int32_t Motor::get_current_draw(void) const { return c::motor_get_current_draw(_port); }
+std::int32_t Motor::get_direction(void) const { return c::motor_get_direction(_port); }
+double Motor::get_efficiency(void) const { return c::motor_get_efficiency(_port); }
+std::int32_t Motor::is_over_current(void) const { return c::motor_is_over_current(_port); }
+std::int32_t Motor::is_stopped(void) const { return c::motor_is_stopped(_port); }
+std::int32_t Motor::get_zero_position_flag(void) const { return c::motor_get_zero_position_flag(_port); }
+std::uint32_t Motor::get_faults(void) const { return c::motor_get_faults(_port); }
+std::uint32_t Motor::get_flags(void) const { return c::motor_get_flags(_port); }
+std::int32_t Motor::get_raw_position(std::uint32_t* const timestamp) const {
+    return c::motor_get_raw_position(_port, timestamp);
+}
+std::int32_t Motor::is_over_temp(void) const { return c::motor_is_over_temp(_port); }
+double Motor::get_position(void) const { return c::motor_get_position(_port); }
+double Motor::get_power(void) const { return c::motor_get_power(_port); }
+double Motor::get_temperature(void) const { return c::motor_get_temperature(_port); }
+double Motor::get_torque(void) const { return c::motor_get_torque(_port); }
+std::int32_t Motor::get_voltage(void) const { return c::motor_get_voltage(_port); }
+std::int32_t Motor::set_zero_position(const double position) const { return c::motor_set_zero_position(_port, position); }
+std::int32_t Motor::tare_position(void) const { return c::motor_tare_position(_port); }
+std::int32_t Motor::set_brake_mode(const motor_brake_mode_e_t mode) const { return c::motor_set_brake_mode(_port, mode); }
+std::int32_t Motor::set_current_limit(const std::int32_t limit) const { return c::motor_set_current_limit(_port, limit); }
+std::int32_t Motor::set_encoder_units(const motor_encoder_units_e_t units) const {
+    return c::motor_set_encoder_units(_port, units);
+}
+std::int32_t Motor::set_gearing(const motor_gearset_e_t gearset) const { return c::motor_set_gearing(_port, gearset); }
+motor_pid_s_t Motor::convert_pid(double kf, double kp, double ki, double kd) {
+    return c::motor_convert_pid(kf, kp, ki, kd);
+}
+motor_pid_full_s_t Motor::convert_pid_full(double kf, double kp, double ki, double kd, double filter, double limit,
+                                           double threshold, double loopspeed) {
+    return c::motor_convert_pid_full(kf, kp, ki, kd, filter, limit, threshold, loopspeed);
+}
+std::int32_t Motor::set_pos_pid(const motor_pid_s_t pid) const { return c::motor_set_pos_pid(_port, pid); }
+std::int32_t Motor::set_pos_pid_full(const motor_pid_full_s_t pid) const { return c::motor_set_pos_pid_full(_port, pid); }
+std::int32_t Motor::set_vel_pid(const motor_pid_s_t pid) const { return c::motor_set_vel_pid(_port, pid); }
+std::int32_t Motor::set_vel_pid_full(const motor_pid_full_s_t pid) const { return c::motor_set_vel_pid_full(_port, pid); }
+std::int32_t Motor::set_reversed(const bool reverse) const { return c::motor_set_reversed(_port, reverse); }
+std::int32_t Motor::set_voltage_limit(const std::int32_t limit) const { return c::motor_set_voltage_limit(_port, limit); }
+motor_brake_mode_e_t Motor::get_brake_mode(void) const { return c::motor_get_brake_mode(_port); }
+std::int32_t Motor::get_current_limit(void) const { return c::motor_get_current_limit(_port); }
+motor_encoder_units_e_t Motor::get_encoder_units(void) const { return c::motor_get_encoder_units(_port); }
+motor_gearset_e_t Motor::get_gearing(void) const { return c::motor_get_gearing(_port); }
+motor_pid_full_s_t Motor::get_pos_pid(void) const { return c::motor_get_pos_pid(_port); }
+motor_pid_full_s_t Motor::get_vel_pid(void) const { return c::motor_get_vel_pid(_port); }
+std::int32_t Motor::is_reversed(void) const { return c::motor_is_reversed(_port); }
+std::int32_t Motor::get_voltage_limit(void) const { return c::motor_get_voltage_limit(_port); }
+std::uint8_t Motor::get_port(void) const { return _port; }
+
+Motor_Group::Motor_Group(const std::initializer_list<Motor> motors): _motors(motors), _motor_count(motors.size()) {}
+
+Motor_Group::Motor_Group(const std::vector<std::int8_t> motor_ports): _motor_count(motor_ports.size()) {
+    for (std::int8_t port : motor_ports) _motors.emplace_back(port);
+}
+
+std::int32_t Motor_Group::operator=(std::int32_t voltage) { return move(voltage); }
+
+std::int32_t Motor_Group::move(std::int32_t voltage) {
+    std::int32_t out = 1;
+    for (Motor& motor : _motors) if (motor.move(voltage) == PROS_ERR) out = PROS_ERR;
+    return out;
+}
+
+std::int32_t Motor_Group::move_absolute(const double position, const std::int32_t velocity) {
+    std::int32_t out = 1;
+    for (Motor& motor : _motors) if (motor.move_absolute(position, velocity) == PROS_ERR) out = PROS_ERR;
+    return out;
+}
+
+std::int32_t Motor_Group::move_relative(const double position, const std::int32_t velocity) {
+    std::int32_t out = 1;
+    for (Motor& motor : _motors) if (motor.move_relative(position, velocity) == PROS_ERR) out = PROS_ERR;
+    return out;
+}
+
+std::int32_t Motor_Group::move_velocity(const std::int32_t velocity) {
+    std::int32_t out = 1;
+    for (Motor& motor : _motors) if (motor.move_velocity(velocity) == PROS_ERR) out = PROS_ERR;
+    return out;
+}
+
+std::int32_t Motor_Group::move_voltage(const std::int32_t voltage) {
+    std::int32_t out = 1;
+    for (Motor& motor : _motors) if (motor.move_voltage(voltage) == PROS_ERR) out = PROS_ERR;
+    return out;
+}
+
+std::int32_t Motor_Group::brake(void) {
+    std::int32_t out = 1;
+    for (Motor& motor : _motors) if (motor.brake() == PROS_ERR) out = PROS_ERR;
+    return out;
+}
+
+pros::Motor& Motor_Group::operator[](int i) {
+    return _motors[i];
+}
+
+std::int32_t Motor_Group::size() {
+    return _motor_count;
+}
+
+std::int32_t Motor_Group::set_zero_position(const double position) {
+    std::int32_t out = 1;
+    for (Motor& motor : _motors) if (motor.set_zero_position(position) == PROS_ERR) out = PROS_ERR;
+    return out;
+}
+
+std::int32_t Motor_Group::set_brake_modes(motor_brake_mode_e_t mode) {
+    std::int32_t out = 1;
+    for (Motor& motor : _motors) if (motor.set_brake_mode(mode) == PROS_ERR) out = PROS_ERR;
+    return out;
+}
+
+std::int32_t Motor_Group::set_reversed(const bool reversed) {
+    std::int32_t out = 1;
+    for (Motor& motor : _motors) if (motor.set_reversed(reversed) == PROS_ERR) out = PROS_ERR;
+    return out;
+}
+
+std::int32_t Motor_Group::set_voltage_limit(const std::int32_t limit) {
+    std::int32_t out = 1;
+    for (Motor& motor : _motors) if (motor.set_voltage_limit(limit) == PROS_ERR) out = PROS_ERR;
+    return out;
+}
+
+std::int32_t Motor_Group::set_gearing(const motor_gearset_e_t gearset) {
+    std::int32_t out = 1;
+    for (Motor& motor : _motors) if (motor.set_gearing(gearset) == PROS_ERR) out = PROS_ERR;
+    return out;
+}
+
+std::int32_t Motor_Group::set_encoder_units(const motor_encoder_units_e_t units) {
+    std::int32_t out = 1;
+    for (Motor& motor : _motors) if (motor.set_encoder_units(units) == PROS_ERR) out = PROS_ERR;
+    return out;
+}
+
+std::int32_t Motor_Group::tare_position(void) {
+    std::int32_t out = 1;
+    for (Motor& motor : _motors) if (motor.tare_position() == PROS_ERR) out = PROS_ERR;
+    return out;
+}
+
+std::vector<double> Motor_Group::get_actual_velocities(void) {
+    std::vector<double> out;
+    for (Motor& motor : _motors) out.push_back(motor.get_actual_velocity());
+    return out;
+}
+
+std::vector<std::int32_t> Motor_Group::get_target_velocities(void) {
+    std::vector<std::int32_t> out;
+    for (Motor& motor : _motors) out.push_back(motor.get_target_velocity());
+    return out;
+}
+
+std::vector<double> Motor_Group::get_target_positions(void) {
+    std::vector<double> out;
+    for (Motor& motor : _motors) out.push_back(motor.get_target_position());
+    return out;
+}
+
+std::vector<double> Motor_Group::get_positions(void) {
+    std::vector<double> out;
+    for (Motor& motor : _motors) out.push_back(motor.get_position());
+    return out;
+}
+
+std::vector<double> Motor_Group::get_efficiencies(void) {
+    std::vector<double> out;
+    for (Motor& motor : _motors) out.push_back(motor.get_efficiency());
+    return out;
+}
+
+std::vector<std::int32_t> Motor_Group::are_over_current(void) {
+    std::vector<std::int32_t> out;
+    for (Motor& motor : _motors) out.push_back(motor.is_over_current());
+    return out;
+}
+
+std::vector<std::int32_t> Motor_Group::are_over_temp(void) {
+    std::vector<std::int32_t> out;
+    for (Motor& motor : _motors) out.push_back(motor.is_over_temp());
+    return out;
+}
+
+std::vector<pros::motor_brake_mode_e_t> Motor_Group::get_brake_modes(void) {
+    std::vector<pros::motor_brake_mode_e_t> out;
+    for (Motor& motor : _motors) out.push_back(motor.get_brake_mode());
+    return out;
+}
+
+std::vector<motor_gearset_e_t> Motor_Group::get_gearing(void) {
+    std::vector<motor_gearset_e_t> out;
+    for (Motor& motor : _motors) out.push_back(motor.get_gearing());
+    return out;
+}
+
+std::vector<std::int32_t> Motor_Group::get_current_draws(void) {
+    std::vector<std::int32_t> out;
+    for (Motor& motor : _motors) out.push_back(motor.get_current_draw());
+    return out;
+}
+
+std::vector<std::int32_t> Motor_Group::get_current_limits(void) {
+    std::vector<std::int32_t> out;
+    for (Motor& motor : _motors) out.push_back(motor.get_current_limit());
+    return out;
+}
+
+std::vector<std::uint8_t> Motor_Group::get_ports(void) {
+    std::vector<std::uint8_t> out;
+    for (Motor& motor : _motors) out.push_back(motor.get_port());
+    return out;
+}
+
+std::vector<std::int32_t> Motor_Group::get_directions(void) {
+    std::vector<std::int32_t> out;
+    for (Motor& motor : _motors) out.push_back(motor.get_direction());
+    return out;
+}
+
+std::vector<pros::motor_encoder_units_e_t> Motor_Group::get_encoder_units(void) {
+    std::vector<pros::motor_encoder_units_e_t> out;
+    for (Motor& motor : _motors) out.push_back(motor.get_encoder_units());
+    return out;
+}
+
+namespace literals {
+const pros::Motor operator"" _mtr(const unsigned long long int m) {
+    return Motor(m);
+}
+const pros::Motor operator"" _rmtr(const unsigned long long int m) {
+    return Motor(m, true);
+}
+} // namespace literals
+
+} // namespace pros
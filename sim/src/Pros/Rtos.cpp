@@ -0,0 +1,318 @@
+// Stand-in for the PROS RTOS API on top of sim::Scheduler
+
+#include "pros/error.h"
+#include "pros/rtos.hpp"
+#include "Simulation/World.h"
+#include <string.h>
+
+using sim::SimTask;
+using sim::TaskState;
+using sim::World;
+
+namespace pros {
+namespace c {
+
+namespace {
+
+typedef struct SimMutex {
+    SimTask* owner = nullptr;
+    bool taken = false;
+} SimMutex;
+
+SimTask* toTask(task_t task) {
+    return task ? static_cast<SimTask*>(task) : World::current().scheduler.current();
+}
+
+} // namespace
+
+uint32_t millis(void) {
+    return World::current().getTime() / 1000;
+}
+
+uint64_t micros(void) {
+    return World::current().getTime();
+}
+
+task_t task_create(task_fn_t function, void* const parameters, uint32_t prio, const uint16_t stack_depth,
+                   const char* const name) {
+    return World::current().scheduler.create(function, parameters, prio, name);
+}
+
+void task_delete(task_t task) {
+    World::current().scheduler.remove(static_cast<SimTask*>(task));
+}
+
+void task_delay(const uint32_t milliseconds) {
+    World& world = World::current();
+    world.scheduler.sleepUntil(world.getTime() + milliseconds * 1000ULL);
+}
+
+void delay(const uint32_t milliseconds) {
+    task_delay(milliseconds);
+}
+
+// Sleep until *prev_time + delta, then advance *prev_time by delta so the period does not drift
+void task_delay_until(uint32_t* const prev_time, const uint32_t delta) {
+    World& world = World::current();
+    *prev_time += delta;
+    world.scheduler.sleepUntil(*prev_time * 1000ULL);
+}
+
+uint32_t task_get_priority(task_t task) {
+    SimTask* t = toTask(task);
+    return t ? t->priority : TASK_PRIORITY_DEFAULT;
+}
+
+void task_set_priority(task_t task, uint32_t prio) {
+    SimTask* t = toTask(task);
+    if (t) t->priority = prio;
+}
+
+task_state_e_t task_get_state(task_t task) {
+    SimTask* t = toTask(task);
+    if (!t) return E_TASK_STATE_INVALID;
+
+    switch (t->state) {
+        case TaskState::RUNNING:
+            return E_TASK_STATE_RUNNING;
+        case TaskState::READY:
+            return E_TASK_STATE_READY;
+        case TaskState::BLOCKED:
+            return E_TASK_STATE_BLOCKED;
+        case TaskState::SUSPENDED:
+            return E_TASK_STATE_SUSPENDED;
+        default:
+            return E_TASK_STATE_DELETED;
+    }
+}
+
+void task_suspend(task_t task) {
+    World::current().scheduler.suspend(static_cast<SimTask*>(task));
+}
+
+void task_resume(task_t task) {
+    World::current().scheduler.resume(static_cast<SimTask*>(task));
+}
+
+uint32_t task_get_count(void) {
+    return World::current().scheduler.getTaskCount();
+}
+
+char* task_get_name(task_t task) {
+    SimTask* t = toTask(task);
+    return t ? const_cast<char*>(t->name.c_str()) : nullptr;
+}
+
+task_t task_get_by_name(const char* name) {
+    return World::current().scheduler.findByName(name);
+}
+
+task_t task_get_current() {
+    return World::current().scheduler.current();
+}
+
+uint32_t task_notify(task_t task) {
+    return task_notify_ext(task, 1, E_NOTIFY_ACTION_INCR, nullptr);
+}
+
+void task_join(task_t task) {
+    SimTask* t = static_cast<SimTask*>(task);
+    while (t && t->state != TaskState::DELETED) task_delay(1);
+}
+
+uint32_t task_notify_ext(task_t task, uint32_t value, notify_action_e_t action, uint32_t* prev_value) {
+
+    SimTask* t = toTask(task);
+    if (!t) return 0;
+    if (prev_value) *prev_value = t->notifyValue;
+
+    switch (action) {
+        case E_NOTIFY_ACTION_BITS:
+            t->notifyValue |= value;
+            break;
+        case E_NOTIFY_ACTION_INCR:
+            t->notifyValue++;
+            break;
+        case E_NOTIFY_ACTION_OWRITE:
+            t->notifyValue = value;
+            break;
+        case E_NOTIFY_ACTION_NO_OWRITE:
+            if (t->notifyValue != 0) return 0;
+            t->notifyValue = value;
+            break;
+        default:
+            break;
+    }
+    return 1;
+}
+
+// Polls once per millisecond, which keeps the scheduler simple and deterministic
+uint32_t task_notify_take(bool clear_on_exit, uint32_t timeout) {
+
+    SimTask* t = World::current().scheduler.current();
+    if (!t) return 0;
+
+    uint32_t start = millis();
+    while (t->notifyValue == 0 && (timeout == TIMEOUT_MAX || millis() - start < timeout)) task_delay(1);
+
+    uint32_t value = t->notifyValue;
+    if (value == 0) return 0;
+
+    t->notifyValue = clear_on_exit ? 0 : value - 1;
+    return value;
+}
+
+bool task_notify_clear(task_t task) {
+    SimTask* t = toTask(task);
+    if (!t) return false;
+
+    bool wasPending = t->notifyValue != 0;
+    t->notifyValue = 0;
+    return wasPending;
+}
+
+mutex_t mutex_create(void) {
+    return new SimMutex();
+}
+
+bool mutex_take(mutex_t mutex, uint32_t timeout) {
+
+    SimMutex* m = static_cast<SimMutex*>(mutex);
+    SimTask* self = World::current().scheduler.current();
+
+    uint32_t start = millis();
+    while (m->taken && m->owner != self) {
+        if (timeout != TIMEOUT_MAX && millis() - start >= timeout) {
+            errno = EACCES;
+            return false;
+        }
+        task_delay(1);
+    }
+
+    m->taken = true;
+    m->owner = self;
+    return true;
+}
+
+bool mutex_give(mutex_t mutex) {
+    SimMutex* m = static_cast<SimMutex*>(mutex);
+    m->taken = false;
+    m->owner = nullptr;
+    return true;
+}
+
+void mutex_delete(mutex_t mutex) {
+    delete static_cast<SimMutex*>(mutex);
+}
+
+} // namespace c
+
+Task::Task(task_fn_t function, void* parameters, std::uint32_t prio, std::uint16_t stack_depth, const char* name) {
+    task = c::task_create(function, parameters, prio, stack_depth, name);
+}
+
+Task::Task(task_fn_t function, void* parameters, const char* name):
+    Task(function, parameters, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, name) {}
+
+Task::Task(task_t taskP): task(taskP) {}
+
+Task Task::current() {
+    return Task(c::task_get_current());
+}
+
+Task& Task::operator=(task_t in) {
+    task = in;
+    return *this;
+}
+
+void Task::remove() {
+    c::task_delete(task);
+}
+
+std::uint32_t Task::get_priority() {
+    return c::task_get_priority(task);
+}
+
+void Task::set_priority(std::uint32_t prio) {
+    c::task_set_priority(task, prio);
+}
+
+std::uint32_t Task::get_state() {
+    return c::task_get_state(task);
+}
+
+void Task::suspend() {
+    c::task_suspend(task);
+}
+
+void Task::resume() {
+    c::task_resume(task);
+}
+
+const char* Task::get_name() {
+    return c::task_get_name(task);
+}
+
+std::uint32_t Task::notify() {
+    return c::task_notify(task);
+}
+
+void Task::join() {
+    c::task_join(task);
+}
+
+std::uint32_t Task::notify_ext(std::uint32_t value, notify_action_e_t action, std::uint32_t* prev_value) {
+    return c::task_notify_ext(task, value, action, prev_value);
+}
+
+std::uint32_t Task::notify_take(bool clear_on_exit, std::uint32_t timeout) {
+    return c::task_notify_take(clear_on_exit, timeout);
+}
+
+bool Task::notify_clear() {
+    return c::task_notify_clear(task);
+}
+
+void Task::delay(const std::uint32_t milliseconds) {
+    c::task_delay(milliseconds);
+}
+
+void Task::delay_until(std::uint32_t* const prev_time, const std::uint32_t delta) {
+    c::task_delay_until(prev_time, delta);
+}
+
+std::uint32_t Task::get_count() {
+    return c::task_get_count();
+}
+
+Clock::time_point Clock::now() {
+    return time_point{duration{c::millis()}};
+}
+
+Mutex::Mutex(): mutex(c::mutex_create(), c::mutex_delete) {}
+
+bool Mutex::take() {
+    return c::mutex_take(mutex.get(), TIMEOUT_MAX);
+}
+
+bool Mutex::take(std::uint32_t timeout) {
+    return c::mutex_take(mutex.get(), timeout);
+}
+
+bool Mutex::give() {
+    return c::mutex_give(mutex.get());
+}
+
+void Mutex::lock() {
+    while (!take(TIMEOUT_MAX)) continue;
+}
+
+void Mutex::unlock() {
+    give();
+}
+
+bool Mutex::try_lock() {
+    return take(0);
+}
+
+} // namespace pros
@@ -0,0 +1,131 @@
+// Stand-in for the PROS brain screen drawing API. Nothing is rendered; calls are counted and charged.
+// Scrolling, area copies and touch input are not simulated
+
+#include "pros/error.h"
+#include "pros/screen.hpp"
+#include "Simulation/World.h"
+#include <stdarg.h>
+#include <stdio.h>
+
+using sim::SimDisplay;
+using sim::World;
+
+namespace {
+
+SimDisplay& draw(uint32_t cost) {
+    World& world = World::current();
+    world.stats.screenCalls++;
+    world.charge(cost);
+    world.display.drawCalls++;
+    return world.display;
+}
+
+uint32_t drawShape() {
+    draw(World::current().costs.screenDraw);
+    return 1;
+}
+
+} // namespace
+
+namespace pros {
+namespace c {
+
+uint32_t screen_set_pen(uint32_t color) {
+    World::current().display.pen = color;
+    return 1;
+}
+
+uint32_t screen_set_eraser(uint32_t color) {
+    World::current().display.eraser = color;
+    return 1;
+}
+
+uint32_t screen_get_pen(void) {
+    return World::current().display.pen;
+}
+
+uint32_t screen_get_eraser(void) {
+    return World::current().display.eraser;
+}
+
+uint32_t screen_erase(void) {
+    draw(World::current().costs.screenErase);
+    return 1;
+}
+
+uint32_t screen_draw_pixel(int16_t x, int16_t y) { return drawShape(); }
+uint32_t screen_erase_pixel(int16_t x, int16_t y) { return drawShape(); }
+uint32_t screen_draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1) { return drawShape(); }
+uint32_t screen_erase_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1) { return drawShape(); }
+uint32_t screen_draw_rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1) { return drawShape(); }
+uint32_t screen_erase_rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1) { return drawShape(); }
+uint32_t screen_fill_rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1) { return drawShape(); }
+uint32_t screen_draw_circle(int16_t x, int16_t y, int16_t radius) { return drawShape(); }
+uint32_t screen_erase_circle(int16_t x, int16_t y, int16_t radius) { return drawShape(); }
+uint32_t screen_fill_circle(int16_t x, int16_t y, int16_t radius) { return drawShape(); }
+
+uint32_t screen_vprintf_at(text_format_e_t txt_fmt, const int16_t x, const int16_t y, const char* text, va_list args) {
+    char buffer[128];
+    vsnprintf(buffer, sizeof(buffer), text, args);
+    draw(World::current().costs.screenDraw).lastPrint = buffer;
+    return 1;
+}
+
+uint32_t screen_vprintf(text_format_e_t txt_fmt, const int16_t line, const char* text, va_list args) {
+    return screen_vprintf_at(txt_fmt, 0, line * 20, text, args);
+}
+
+uint32_t screen_print_at(text_format_e_t txt_fmt, const int16_t x, const int16_t y, const char* text, ...) {
+    va_list args;
+    va_start(args, text);
+    uint32_t out = screen_vprintf_at(txt_fmt, x, y, text, args);
+    va_end(args);
+    return out;
+}
+
+uint32_t screen_print(text_format_e_t txt_fmt, const int16_t line, const char* text, ...) {
+    va_list args;
+    va_start(args, text);
+    uint32_t out = screen_vprintf(txt_fmt, line, text, args);
+    va_end(args);
+    return out;
+}
+
+} // namespace c
+
+namespace screen {
+
+std::uint32_t set_pen(const std::uint32_t color) { return c::screen_set_pen(color); }
+std::uint32_t set_eraser(const std::uint32_t color) { return c::screen_set_eraser(color); }
+std::uint32_t get_pen() { return c::screen_get_pen(); }
+std::uint32_t get_eraser() { return c::screen_get_eraser(); }
+std::uint32_t erase() { return c::screen_erase(); }
+std::uint32_t draw_pixel(const std::int16_t x, const std::int16_t y) { return c::screen_draw_pixel(x, y); }
+std::uint32_t erase_pixel(const std::int16_t x, const std::int16_t y) { return c::screen_erase_pixel(x, y); }
+std::uint32_t draw_line(const std::int16_t x0, const std::int16_t y0, const std::int16_t x1, const std::int16_t y1) {
+    return c::screen_draw_line(x0, y0, x1, y1);
+}
+std::uint32_t erase_line(const std::int16_t x0, const std::int16_t y0, const std::int16_t x1, const std::int16_t y1) {
+    return c::screen_erase_line(x0, y0, x1, y1);
+}
+std::uint32_t draw_rect(const std::int16_t x0, const std::int16_t y0, const std::int16_t x1, const std::int16_t y1) {
+    return c::screen_draw_rect(x0, y0, x1, y1);
+}
+std::uint32_t erase_rect(const std::int16_t x0, const std::int16_t y0, const std::int16_t x1, const std::int16_t y1) {
+    return c::screen_erase_rect(x0, y0, x1, y1);
+}
+std::uint32_t fill_rect(const std::int16_t x0, const std::int16_t y0, const std::int16_t x1, const std::int16_t y1) {
+    return c::screen_fill_rect(x0, y0, x1, y1);
+}
+std::uint32_t draw_circle(const std::int16_t x, const std::int16_t y, const std::int16_t radius) {
+    return c::screen_draw_circle(x, y, radius);
+}
+std::uint32_t erase_circle(const std::int16_t x, const std::int16_t y, const std::int16_t radius) {
+    return c::screen_erase_circle(x, y, radius);
+}
+std::uint32_t fill_circle(const std::int16_t x, const std::int16_t y, const std::int16_t radius) {
+    return c::screen_fill_circle(x, y, radius);
+}
+
+} // namespace screen
+} // namespace pros
@@ -0,0 +1,48 @@
+#include "Simulation/CataPlant.h"
+
+namespace sim {
+
+CataParameters getRobot18Cata() {
+    CataParameters params;
+    params.ports = {16, -17};
+    params.limitSwitchPort = 'A';
+    return params;
+}
+
+CataPlant::CataPlant(World& w, CataParameters parameters):
+    world(w),
+    params(parameters)
+{
+    for (int8_t port : params.ports) {
+        SimMotor* m = world.getMotor(abs(port));
+        if (!m) continue;
+
+        m->loadInertia = params.loadInertia;
+        if (!motor) {
+            motor = m;
+            mount = port < 0 ? -1 : 1;
+        }
+    }
+    world.addPlant(this);
+}
+
+CataPlant::~CataPlant() {
+    world.removePlant(this);
+}
+
+void CataPlant::step(double dt) {
+
+    SimAdiPort* limitSwitch = world.getAdiPort(params.limitSwitchPort);
+    if (!motor || !limitSwitch) return;
+
+    // Arm angle since the loaded position, wrapped to one revolution
+    double arm = mount * motor->angle * params.armRatio;
+    double phase = fmod(fmod(arm, 2 * M_PI) + 2 * M_PI, 2 * M_PI);
+
+    int revolutions = (int) floor(arm / (2 * M_PI));
+    if (revolutions > shots) shots = revolutions;
+
+    limitSwitch->value = phase < params.switchWindow ? 1 : 0;
+}
+
+} // namespace sim
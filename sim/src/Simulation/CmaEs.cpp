@@ -0,0 +1,158 @@
+#include "Simulation/CmaEs.h"
+#include <algorithm>
+#include <math.h>
+#include <numeric>
+
+namespace sim {
+
+CmaEs::CmaEs(std::vector<double> initialMean, double initialSigma, int populationSize, uint32_t seed):
+    n(initialMean.size()),
+    mean(initialMean),
+    sigma(initialSigma),
+    random(seed)
+{
+    lambda = populationSize > 0 ? populationSize : 4 + (int) (3 * log(n));
+    mu = lambda / 2;
+
+    double weightSum = 0, weightSquares = 0;
+    for (int i = 0; i < mu; i++) {
+        weights.push_back(log(mu + 0.5) - log(i + 1));
+        weightSum += weights[i];
+    }
+    for (double& w : weights) {
+        w /= weightSum;
+        weightSquares += w * w;
+    }
+    muEff = 1 / weightSquares;
+
+    cc = (4 + muEff / n) / (n + 4 + 2 * muEff / n);
+    cs = (muEff + 2) / (n + muEff + 5);
+    c1 = 2 / ((n + 1.3) * (n + 1.3) + muEff);
+    cMu = fmin(1 - c1, 2 * (muEff - 2 + 1 / muEff) / ((n + 2) * (n + 2) + muEff));
+    damps = 1 + 2 * fmax(0, sqrt((muEff - 1) / (n + 1)) - 1) + cs;
+    chiN = sqrt(n) * (1 - 1.0 / (4 * n) + 1.0 / (21 * n * n));
+
+    pc.assign(n, 0);
+    ps.assign(n, 0);
+    C.assign(n, std::vector<double>(n, 0));
+    B.assign(n, std::vector<double>(n, 0));
+    D.assign(n, 1);
+    for (int i = 0; i < n; i++) C[i][i] = B[i][i] = 1;
+}
+
+std::vector<std::vector<double>> CmaEs::ask() {
+
+    std::normal_distribution<double> normal(0, 1);
+
+    std::vector<std::vector<double>> candidates(lambda, std::vector<double>(n));
+    for (std::vector<double>& x : candidates) {
+        std::vector<double> z(n);
+        for (double& value : z) value = normal(random);
+        for (int i = 0; i < n; i++) {
+            double y = 0;
+            for (int j = 0; j < n; j++) y += B[i][j] * D[j] * z[j];
+            x[i] = mean[i] + sigma * y;
+        }
+    }
+    return candidates;
+}
+
+void CmaEs::tell(const std::vector<std::vector<double>>& candidates, const std::vector<double>& costs) {
+
+    std::vector<int> order(candidates.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return costs[a] < costs[b]; });
+
+    std::vector<double> oldMean = mean;
+    for (int i = 0; i < n; i++) {
+        mean[i] = 0;
+        for (int k = 0; k < mu; k++) mean[i] += weights[k] * candidates[order[k]][i];
+    }
+
+    // Evolution paths. C^-1/2 = B D^-1 B^T
+    std::vector<double> step(n), whitened(n, 0);
+    for (int i = 0; i < n; i++) step[i] = (mean[i] - oldMean[i]) / sigma;
+    for (int j = 0; j < n; j++) {
+        double projection = 0;
+        for (int i = 0; i < n; i++) projection += B[i][j] * step[i];
+        for (int i = 0; i < n; i++) whitened[i] += B[i][j] * projection / D[j];
+    }
+
+    double psNorm = 0;
+    for (int i = 0; i < n; i++) {
+        ps[i] = (1 - cs) * ps[i] + sqrt(cs * (2 - cs) * muEff) * whitened[i];
+        psNorm += ps[i] * ps[i];
+    }
+    psNorm = sqrt(psNorm);
+    generation++;
+
+    bool hSigma = psNorm / sqrt(1 - pow(1 - cs, 2 * generation)) / chiN < 1.4 + 2.0 / (n + 1);
+    for (int i = 0; i < n; i++) {
+        pc[i] = (1 - cc) * pc[i] + (hSigma ? sqrt(cc * (2 - cc) * muEff) * step[i] : 0);
+    }
+
+    // Rank-one and rank-mu covariance updates
+    double correction = hSigma ? 0 : c1 * cc * (2 - cc);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j <= i; j++) {
+            double rankMu = 0;
+            for (int k = 0; k < mu; k++) {
+                const std::vector<double>& x = candidates[order[k]];
+                rankMu += weights[k] * (x[i] - oldMean[i]) / sigma * (x[j] - oldMean[j]) / sigma;
+            }
+            C[i][j] = (1 - c1 - cMu) * C[i][j] + c1 * (pc[i] * pc[j] + correction * C[i][j]) + cMu * rankMu;
+            C[j][i] = C[i][j];
+        }
+    }
+
+    sigma *= exp(cs / damps * (psNorm / chiN - 1));
+    decompose();
+}
+
+// Jacobi eigenvalue iteration. n is tiny, so simplicity wins over speed
+void CmaEs::decompose() {
+
+    Matrix A = C;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) B[i][j] = i == j;
+    }
+
+    for (int sweep = 0; sweep < 50; sweep++) {
+
+        double offDiagonal = 0;
+        for (int i = 0; i < n; i++) {
+            for (int j = i + 1; j < n; j++) offDiagonal += A[i][j] * A[i][j];
+        }
+        if (offDiagonal < 1e-22) break;
+
+        for (int p = 0; p < n; p++) {
+            for (int q = p + 1; q < n; q++) {
+                if (fabs(A[p][q]) < 1e-300) continue;
+
+                double theta = (A[q][q] - A[p][p]) / (2 * A[p][q]);
+                double t = (theta >= 0 ? 1 : -1) / (fabs(theta) + sqrt(theta * theta + 1));
+                double c = 1 / sqrt(t * t + 1), s = t * c;
+
+                for (int k = 0; k < n; k++) {
+                    double akp = A[k][p], akq = A[k][q];
+                    A[k][p] = c * akp - s * akq;
+                    A[k][q] = s * akp + c * akq;
+                }
+                for (int k = 0; k < n; k++) {
+                    double apk = A[p][k], aqk = A[q][k];
+                    A[p][k] = c * apk - s * aqk;
+                    A[q][k] = s * apk + c * aqk;
+                }
+                for (int k = 0; k < n; k++) {
+                    double bkp = B[k][p], bkq = B[k][q];
+                    B[k][p] = c * bkp - s * bkq;
+                    B[k][q] = s * bkp + c * bkq;
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < n; i++) D[i] = sqrt(fmax(A[i][i], 1e-20));
+}
+
+} // namespace sim
@@ -0,0 +1,191 @@
+#include "Simulation/DrivetrainPlant.h"
+#include "misc/MathUtility.h"
+
+namespace sim {
+
+static constexpr double GRAVITY = 9.81;
+
+DrivetrainParameters getRobot15Drivetrain() {
+    DrivetrainParameters params;
+    params.leftPorts = {-13, -14, 15, 17};
+    params.rightPorts = {-9, 18, -20, 21};
+    params.externalGearRatio = 3.0/4.0;
+    params.wheelDiameter = 2.73;
+    params.trackWidth = 14.25;
+    params.imuPorts = {1, 3};
+    return params;
+}
+
+DrivetrainParameters getRobot18Drivetrain() {
+    DrivetrainParameters params;
+    params.leftPorts = {11, 12, -13, -14};
+    params.rightPorts = {1, 2, -3, -4};
+    params.externalGearRatio = 3.0/4.0;
+    params.wheelDiameter = 2.74;
+    params.trackWidth = 14.25;
+    params.imuPorts = {8, 9};
+    params.mass = 7.7;
+    params.momentOfInertia = 0.21;
+    return params;
+}
+
+DrivetrainPlant::DrivetrainPlant(World& w, DrivetrainParameters parameters):
+    world(w),
+    params(parameters),
+    wheelRadius(parameters.wheelDiameter / 2 / METERS_TO_INCHES),
+    halfTrack(parameters.trackWidth / 2 / METERS_TO_INCHES)
+{
+    attach(left, params.leftPorts);
+    attach(right, params.rightPorts);
+    world.addPlant(this);
+    updateSensors();
+}
+
+DrivetrainPlant::~DrivetrainPlant() {
+    world.removePlant(this);
+    for (Side* side : {&left, &right}) {
+        for (SimMotor* motor : side->motors) motor->attached = false;
+    }
+}
+
+void DrivetrainPlant::attach(Side& side, const std::vector<int8_t>& ports) {
+    for (int8_t port : ports) {
+        SimMotor* motor = world.getMotor(abs(port));
+        if (!motor) continue;
+
+        motor->attached = true;
+        side.motors.push_back(motor);
+        side.mounts.push_back(port < 0 ? -1 : 1);
+    }
+}
+
+double DrivetrainPlant::sideTorque(Side& side) {
+
+    double shaftVelocity = side.wheelVelocity / params.externalGearRatio;
+
+    double torque = 0;
+    for (size_t i = 0; i < side.motors.size(); i++) {
+        torque += side.mounts[i] * side.motors[i]->computeTorque(side.mounts[i] * shaftVelocity);
+    }
+    return torque / params.externalGearRatio;
+}
+
+double DrivetrainPlant::sideInertia(const Side& side) {
+
+    double inertia = params.wheelInertia;
+    for (SimMotor* motor : side.motors) {
+        double ratio = motor->getGearRatio() / params.externalGearRatio;
+        inertia += SimMotor::ROTOR_INERTIA * ratio * ratio;
+    }
+    return inertia;
+}
+
+void DrivetrainPlant::step(double dt) {
+
+    double h = dt / SUBSTEPS;
+    double normalForce = params.mass * GRAVITY / 2; // per side
+    double maxTraction = params.traction * normalForce;
+
+    for (int i = 0; i < SUBSTEPS; i++) {
+
+        double groundLeft = velocity - angularVelocity * halfTrack;
+        double groundRight = velocity + angularVelocity * halfTrack;
+
+        // Traction pushes the robot forwards and the wheel backwards, saturating as the wheel slips
+        left.groundForce = maxTraction * tanh((left.wheelVelocity * wheelRadius - groundLeft) / params.slipVelocity);
+        right.groundForce = maxTraction * tanh((right.wheelVelocity * wheelRadius - groundRight) / params.slipVelocity);
+
+        double leftAccel = (sideTorque(left) - left.groundForce * wheelRadius) / sideInertia(left);
+        double rightAccel = (sideTorque(right) - right.groundForce * wheelRadius) / sideInertia(right);
+
+        double rolling = params.rollingResistance * params.mass * GRAVITY * tanh(velocity / 0.01);
+        double scrub = params.scrubTorque * tanh(angularVelocity / 0.1);
+
+        double accel = (left.groundForce + right.groundForce - rolling) / params.mass;
+        double angularAccel = ((right.groundForce - left.groundForce) * halfTrack - scrub) / params.momentOfInertia;
+
+        left.wheelVelocity += leftAccel * h;
+        right.wheelVelocity += rightAccel * h;
+        velocity += accel * h;
+        angularVelocity += angularAccel * h;
+
+        // Integrate the pose along the arc travelled during the substep
+        double midHeading = heading + angularVelocity * h / 2;
+        x += velocity * cos(midHeading) * h;
+        y += velocity * sin(midHeading) * h;
+        heading += angularVelocity * h;
+
+        for (Side* side : {&left, &right}) {
+            double shaftVelocity = side->wheelVelocity / params.externalGearRatio;
+            for (size_t j = 0; j < side->motors.size(); j++) {
+                side->motors[j]->velocity = side->mounts[j] * shaftVelocity;
+                side->motors[j]->angle += side->motors[j]->velocity * h;
+            }
+        }
+    }
+
+    updateSensors();
+}
+
+void DrivetrainPlant::updateSensors() {
+
+    double yaw = -getDegrees(heading);
+    double yawRate = -getDegrees(angularVelocity);
+
+    for (uint8_t port : params.imuPorts) {
+        SimImu* imu = world.getImu(port);
+        if (!imu) continue;
+        imu->yaw = yaw;
+        imu->yawRate = yawRate;
+    }
+
+    if (params.gpsPort) {
+        SimGps* gps = world.getGps(params.gpsPort);
+        if (gps) {
+            uint64_t now = world.getTime();
+            uint64_t latency = (uint64_t) (gps->latency * 1000000);
+            uint64_t reported = now > latency ? now - latency : 0;
+            gpsHistory.push_back({now, x, y, yaw, yawRate});
+            while (gpsHistory.size() > 1 && gpsHistory[1].time <= reported) gpsHistory.pop_front();
+
+            const TimedPose& pose = gpsHistory.front();
+            gps->x = pose.x;
+            gps->y = pose.y;
+            gps->heading = fmod(fmod(pose.yaw, 360) + 360, 360);
+            gps->rotation = pose.yaw;
+            gps->yawRate = pose.yawRate;
+        }
+    }
+}
+
+void DrivetrainPlant::setPose(double newX, double newY, double newHeading) {
+    x = newX / METERS_TO_INCHES;
+    y = newY / METERS_TO_INCHES;
+    heading = newHeading;
+    velocity = angularVelocity = 0;
+    left.wheelVelocity = right.wheelVelocity = 0;
+    gpsHistory.clear(); // placed, not driven there
+    updateSensors();
+}
+
+double DrivetrainPlant::getX() const {
+    return x * METERS_TO_INCHES;
+}
+
+double DrivetrainPlant::getY() const {
+    return y * METERS_TO_INCHES;
+}
+
+double DrivetrainPlant::getVelocity() const {
+    return velocity * METERS_TO_INCHES;
+}
+
+double DrivetrainPlant::getLeftSlip() const {
+    return (left.wheelVelocity * wheelRadius - (velocity - angularVelocity * halfTrack)) * METERS_TO_INCHES;
+}
+
+double DrivetrainPlant::getRightSlip() const {
+    return (right.wheelVelocity * wheelRadius - (velocity + angularVelocity * halfTrack)) * METERS_TO_INCHES;
+}
+
+} // namespace sim
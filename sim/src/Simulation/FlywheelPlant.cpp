@@ -0,0 +1,102 @@
+#include "Simulation/FlywheelPlant.h"
+#include "misc/MathUtility.h"
+
+namespace sim {
+
+static constexpr double RPM_TO_RAD_PER_SEC = 2 * M_PI / 60;
+
+void fitVoltRpmData(FlywheelParameters& params, const std::vector<DataPoint>& voltRpmData) {
+
+    // At a steady velocity w, every motor's current holds up its share of the friction:
+    //     V = (KE / scale + R * ROTOR_FRICTION / KT) * w + R / KT * friction / motors
+    // so a least squares line through the table gives both unknowns
+    size_t n = voltRpmData.size();
+    if (n < 2 || params.ports.empty()) return;
+
+    double meanW = 0, meanV = 0;
+    for (const DataPoint& point : voltRpmData) {
+        meanW += point.rpm * RPM_TO_RAD_PER_SEC / n;
+        meanV += point.volt / n;
+    }
+
+    double covariance = 0, variance = 0;
+    for (const DataPoint& point : voltRpmData) {
+        double w = point.rpm * RPM_TO_RAD_PER_SEC - meanW;
+        covariance += w * (point.volt - meanV);
+        variance += w * w;
+    }
+
+    double slope = covariance / variance;
+    double intercept = meanV - slope * meanW;
+
+    double backEmf = slope - SimMotor::RESISTANCE * SimMotor::ROTOR_FRICTION / SimMotor::KT;
+    params.freeSpeedScale = SimMotor::KE / backEmf;
+    params.frictionTorque = fmax(0, intercept * SimMotor::KT / SimMotor::RESISTANCE * params.ports.size());
+}
+
+FlywheelParameters getRobot15Flywheel(const std::vector<DataPoint>& voltRpmData) {
+    FlywheelParameters params;
+    params.ports = {-4, 8};
+    fitVoltRpmData(params, voltRpmData);
+    return params;
+}
+
+FlywheelPlant::FlywheelPlant(World& w, FlywheelParameters parameters):
+    world(w),
+    params(parameters)
+{
+    for (int8_t port : params.ports) {
+        SimMotor* motor = world.getMotor(abs(port));
+        if (!motor) continue;
+
+        motor->attached = true;
+        motor->freeSpeedScale = params.freeSpeedScale;
+        motor->velocityNoise = params.velocityNoise;
+        motors.push_back(motor);
+        mounts.push_back(port < 0 ? -1 : 1);
+    }
+    world.addPlant(this);
+}
+
+FlywheelPlant::~FlywheelPlant() {
+    world.removePlant(this);
+    for (SimMotor* motor : motors) motor->attached = false;
+}
+
+void FlywheelPlant::step(double dt) {
+
+    double torque = 0;
+    double inertia = params.inertia;
+    for (size_t i = 0; i < motors.size(); i++) {
+        double ratio = motors[i]->getGearRatio();
+        torque += mounts[i] * motors[i]->computeTorque(mounts[i] * velocity / ratio) / ratio;
+        inertia += SimMotor::ROTOR_INERTIA;
+    }
+
+    torque -= params.frictionTorque * tanh(velocity / 1.0);
+
+    // Accelerating the disc to launchRadius * w over the contact time draws 1/2 m (r w)^2 / T of power
+    if (contactRemaining > 0) {
+        torque -= params.discMass * params.launchRadius * params.launchRadius * velocity / (2 * params.contactTime);
+        contactRemaining -= dt;
+        if (contactRemaining <= 0) lastExitVelocity = params.launchRadius * velocity;
+    }
+
+    velocity += torque / inertia * dt;
+
+    for (size_t i = 0; i < motors.size(); i++) {
+        motors[i]->velocity = mounts[i] * velocity / motors[i]->getGearRatio();
+        motors[i]->angle += motors[i]->velocity * dt;
+    }
+}
+
+void FlywheelPlant::launchDisc() {
+    contactRemaining = params.contactTime;
+    discsLaunched++;
+}
+
+double FlywheelPlant::getVelocity() const {
+    return velocity / RPM_TO_RAD_PER_SEC;
+}
+
+} // namespace sim
@@ -0,0 +1,31 @@
+#include "Simulation/Harness.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+
+namespace sim {
+
+StepProbe::StepProbe(World& w, std::function<void()> f): world(w), onStep(f) {
+    world.addPlant(this);
+}
+
+StepProbe::~StepProbe() {
+    world.removePlant(this);
+}
+
+int silenceStdout() {
+    fflush(stdout);
+    int saved = dup(STDOUT_FILENO);
+    int null = open("/dev/null", O_WRONLY);
+    dup2(null, STDOUT_FILENO);
+    close(null);
+    return saved;
+}
+
+void restoreStdout(int saved) {
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+}
+
+} // namespace sim
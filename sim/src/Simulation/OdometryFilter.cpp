@@ -0,0 +1,58 @@
+#include "Simulation/OdometryFilter.h"
+#include "misc/MathUtility.h"
+
+namespace sim {
+
+void OdometryFilter::update(const SensorSnapshot& snapshot) {
+
+    // Wheel travel since power on rather than since resetDistance(), so the motion functions resetting the
+    // drive distance don't show up as a jump in position
+    if (!started) {
+        started = true;
+        prevLeftDistance = snapshot.leftPosition;
+        prevRightDistance = snapshot.rightPosition;
+        prevHeading = snapshot.imuHeading;
+    }
+
+    double left = snapshot.leftPosition;
+    double right = snapshot.rightPosition;
+    double heading = snapshot.imuHeading;
+
+    double deltaLeft = left - prevLeftDistance;
+    double deltaRight = right - prevRightDistance;
+    double deltaHeading = deltaInHeading(heading, prevHeading); // not a full turn when crossing 0
+
+    integrateArc(odomX, odomY, prevHeading, (deltaLeft + deltaRight) / 2, deltaHeading);
+
+    prevLeftDistance = left;
+    prevRightDistance = right;
+    prevHeading = heading;
+
+    // Find filtered position
+    currentX = odomX + biasX;
+    currentY = odomY + biasY;
+    currentHeading = heading + biasHeading;
+
+    // Update bias from gps
+    if (snapshot.gpsError < gains.gpsErrorLimit) {
+        biasX += (snapshot.gpsX - currentX) * gains.kPosition;
+        biasY += (snapshot.gpsY - currentY) * gains.kPosition;
+        biasHeading += deltaInHeading(snapshot.gpsHeading, currentHeading) * gains.kHeading;
+    }
+}
+
+void OdometryFilter::setHeading(double heading, const SensorSnapshot& imus) {
+    if (!started) return;
+    prevHeading = imus.imuHeading;
+    biasHeading = deltaInHeading(heading, imus.imuHeading);
+    currentHeading = imus.imuHeading + biasHeading;
+}
+
+void OdometryFilter::setPosition(double x, double y) {
+    currentX = x;
+    odomX = x;
+    currentY = y;
+    odomY = y;
+}
+
+} // namespace sim
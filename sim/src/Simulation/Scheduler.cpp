@@ -0,0 +1,232 @@
+#include "Simulation/Scheduler.h"
+#include "Simulation/World.h"
+#include <stdio.h>
+#include <stdexcept>
+
+namespace sim {
+
+Scheduler::~Scheduler() {
+    killAll();
+}
+
+SimTask* Scheduler::create(void (*function)(void*), void* parameters, uint32_t priority, const char* name) {
+
+    std::unique_ptr<SimTask> task(new SimTask());
+    task->name = name ? name : "";
+    task->priority = priority;
+    task->function = function;
+    task->parameters = parameters;
+    task->wakeTime = world.getTime();
+    task->sequence = nextSequence++;
+
+    task->stack.reset(new char[STACK_BYTES]);
+    getcontext(&task->context);
+    task->context.uc_stack.ss_sp = task->stack.get();
+    task->context.uc_stack.ss_size = STACK_BYTES;
+    task->context.uc_link = nullptr;
+    makecontext(&task->context, trampoline, 0);
+
+    tasks.push_back(std::move(task));
+    return tasks.back().get();
+}
+
+void Scheduler::trampoline() {
+
+    Scheduler& scheduler = World::current().scheduler;
+    SimTask* task = scheduler.running;
+
+    try {
+        if (!task->killRequested) task->function(task->parameters);
+    } catch (TaskKilled&) {
+        // removed by another task or by the world shutting down
+    } catch (...) {
+        task->error = std::current_exception();
+    }
+
+    task->state = TaskState::DELETED;
+    scheduler.switchToDispatcher(); // never resumed
+}
+
+void Scheduler::switchTo(SimTask* task) {
+
+    running = task;
+    task->state = TaskState::RUNNING;
+    task->switches++;
+    swapcontext(&dispatcherContext, &task->context);
+    running = nullptr;
+
+    if (task->state == TaskState::DELETED) {
+        task->stack.reset();
+        task->program = nullptr;
+    }
+}
+
+void Scheduler::switchToDispatcher() {
+
+    SimTask* task = running;
+    swapcontext(&task->context, &dispatcherContext);
+
+    if (task->killRequested) throw TaskKilled();
+}
+
+// Highest priority due task first, then whichever has been waiting the longest. If nothing is due,
+// advance the clock to the next wake up as long as it is no later than endTime
+SimTask* Scheduler::pickNext(uint64_t endTime) {
+
+    while (true) {
+
+        uint64_t now = world.getTime();
+        SimTask* best = nullptr;
+        uint64_t earliestWake = UINT64_MAX;
+
+        for (auto& t : tasks) {
+            SimTask* task = t.get();
+
+            bool due = task->state == TaskState::READY || (task->state == TaskState::BLOCKED && task->wakeTime <= now);
+            if (!due) {
+                if (task->state == TaskState::BLOCKED && task->wakeTime < earliestWake) earliestWake = task->wakeTime;
+                continue;
+            }
+
+            if (!best
+                || task->priority > best->priority
+                || (task->priority == best->priority && task->wakeTime < best->wakeTime)
+                || (task->priority == best->priority && task->wakeTime == best->wakeTime && task->sequence < best->sequence)) {
+                best = task;
+            }
+        }
+
+        if (best) return best;
+        if (earliestWake == UINT64_MAX || earliestWake > endTime) return nullptr;
+
+        world.advanceTo(earliestWake);
+    }
+}
+
+void Scheduler::sleepUntil(uint64_t wakeTime) {
+
+    // Called from host code outside of any task: let the tasks run in the meantime
+    if (!running) {
+        runUntil(wakeTime);
+        return;
+    }
+
+    running->wakeTime = wakeTime > world.getTime() ? wakeTime : world.getTime();
+    running->state = TaskState::BLOCKED;
+    running->sequence = nextSequence++;
+    switchToDispatcher();
+}
+
+void Scheduler::yield() {
+    sleepUntil(world.getTime());
+}
+
+bool Scheduler::runUntilDone(SimTask* task, uint64_t endTime) {
+
+    while (task->state != TaskState::DELETED) {
+
+        SimTask* next = pickNext(endTime);
+        if (!next) {
+            world.advanceTo(endTime);
+            return false;
+        }
+
+        switchTo(next);
+
+        if (next != task && next->error) {
+            try {
+                std::rethrow_exception(next->error);
+            } catch (std::exception& e) {
+                fprintf(stderr, "[sim] task '%s' terminated by exception: %s\n", next->name.c_str(), e.what());
+            } catch (...) {
+                fprintf(stderr, "[sim] task '%s' terminated by exception\n", next->name.c_str());
+            }
+            next->error = nullptr;
+        }
+    }
+
+    if (task->error) {
+        std::exception_ptr error = task->error;
+        task->error = nullptr;
+        std::rethrow_exception(error);
+    }
+    return true;
+}
+
+void Scheduler::runUntil(uint64_t endTime) {
+
+    SimTask* next;
+    while ((next = pickNext(endTime)) != nullptr) {
+        switchTo(next);
+        if (next->error) {
+            fprintf(stderr, "[sim] task '%s' terminated by exception\n", next->name.c_str());
+            next->error = nullptr;
+        }
+    }
+    world.advanceTo(endTime);
+}
+
+void Scheduler::remove(SimTask* task) {
+
+    if (!task) task = running;
+    if (!task || task->state == TaskState::DELETED) return;
+
+    task->killRequested = true;
+    if (task == running) throw TaskKilled();
+
+    task->state = TaskState::READY;
+    task->wakeTime = world.getTime();
+}
+
+void Scheduler::suspend(SimTask* task) {
+
+    if (!task) task = running;
+    if (!task || task->state == TaskState::DELETED) return;
+
+    task->state = TaskState::SUSPENDED;
+    if (task == running) switchToDispatcher();
+}
+
+void Scheduler::resume(SimTask* task) {
+
+    if (!task || task->state != TaskState::SUSPENDED) return;
+
+    task->state = TaskState::READY;
+    task->wakeTime = world.getTime();
+    task->sequence = nextSequence++;
+}
+
+void Scheduler::killAll() {
+
+    if (running) throw std::logic_error("sim::Scheduler::killAll called from inside a task");
+
+    for (auto& t : tasks) {
+        SimTask* task = t.get();
+        if (task->state == TaskState::DELETED) continue;
+
+        task->killRequested = true;
+        switchTo(task);
+
+        // A task that swallowed TaskKilled is abandoned; its stack is never resumed again
+        task->state = TaskState::DELETED;
+        task->stack.reset();
+        task->program = nullptr;
+    }
+}
+
+SimTask* Scheduler::findByName(const char* name) {
+    for (auto& task : tasks) {
+        if (task->state != TaskState::DELETED && task->name == name) return task.get();
+    }
+    return nullptr;
+}
+
+uint32_t Scheduler::getTaskCount() {
+    uint32_t count = 0;
+    for (auto& task : tasks) {
+        if (task->state != TaskState::DELETED) count++;
+    }
+    return count;
+}
+
+} // namespace sim
@@ -0,0 +1,119 @@
+#include "Simulation/SimMotor.h"
+#include "misc/MathUtility.h"
+
+namespace sim {
+
+double SimMotor::getGearRatio() const {
+    switch (gearset) {
+        case pros::E_MOTOR_GEARSET_36:
+            return 36;
+        case pros::E_MOTOR_GEARSET_06:
+            return 6;
+        default:
+            return 18;
+    }
+}
+
+double SimMotor::getMaxVelocity() const {
+    return 3600 / getGearRatio() * 2 * M_PI / 60;
+}
+
+double SimMotor::getTicksPerRevolution() const {
+    return 50 * getGearRatio();
+}
+
+double SimMotor::toUnits(double radians) const {
+    switch (units) {
+        case pros::E_MOTOR_ENCODER_ROTATIONS:
+            return radians / (2 * M_PI);
+        case pros::E_MOTOR_ENCODER_COUNTS:
+            return radians / (2 * M_PI) * getTicksPerRevolution();
+        default:
+            return getDegrees(radians);
+    }
+}
+
+double SimMotor::fromUnits(double value) const {
+    switch (units) {
+        case pros::E_MOTOR_ENCODER_ROTATIONS:
+            return value * 2 * M_PI;
+        case pros::E_MOTOR_ENCODER_COUNTS:
+            return value / getTicksPerRevolution() * 2 * M_PI;
+        default:
+            return getRadians(value);
+    }
+}
+
+// PI velocity loop with feedforward, roughly what the motor firmware runs at its internal rate
+double SimMotor::runVelocityLoop(double target, double dt) {
+
+    double maxVelocity = getMaxVelocity();
+    double error = target - velocity;
+
+    velocityIntegral = clamp(velocityIntegral + error * dt, -0.5 * maxVelocity, 0.5 * maxVelocity);
+    return 12.0 * (target + 2.0 * error + 4.0 * velocityIntegral) / maxVelocity;
+}
+
+void SimMotor::updateFirmware(double dt, double batteryVoltage) {
+
+    if (!connected) {
+        appliedVoltage = 0;
+        return;
+    }
+
+    double voltage;
+    bool braking = mode == Mode::BRAKE;
+
+    if (braking && !wasBraking) holdAngle = angle;
+    wasBraking = braking;
+
+    if (mode == Mode::VOLTAGE) {
+        velocityIntegral = 0;
+        voltage = targetVoltage;
+    } else if (mode == Mode::VELOCITY) {
+        voltage = runVelocityLoop(targetVelocity, dt);
+    } else if (mode == Mode::POSITION) {
+        double target = clamp(8 * (targetAngle - angle), -profileVelocity, profileVelocity);
+        voltage = runVelocityLoop(target, dt);
+    } else if (brakeMode == pros::E_MOTOR_BRAKE_HOLD) {
+        double target = clamp(8 * (holdAngle - angle), -getMaxVelocity(), getMaxVelocity());
+        voltage = runVelocityLoop(target, dt);
+    } else {
+        velocityIntegral = 0;
+        voltage = 0;
+    }
+
+    double limit = fmin(12.0, batteryVoltage);
+    if (voltageLimit > 0) limit = fmin(limit, voltageLimit / 1000.0);
+    appliedVoltage = clamp(voltage, -limit, limit);
+}
+
+double SimMotor::computeTorque(double shaftVelocity) {
+
+    // Coasting leaves the H-bridge open, so no current flows
+    if (!connected || (mode == Mode::BRAKE && brakeMode == pros::E_MOTOR_BRAKE_COAST)) {
+        current = 0;
+        torque = 0;
+        return 0;
+    }
+
+    double ratio = getGearRatio();
+    double coreVelocity = shaftVelocity * ratio;
+
+    double limit = currentLimit / 1000.0;
+    current = clamp((appliedVoltage - KE / freeSpeedScale * coreVelocity) / RESISTANCE, -limit, limit);
+
+    torque = (KT * current - ROTOR_FRICTION * coreVelocity) * ratio * strength;
+    return torque;
+}
+
+void SimMotor::stepFree(double dt) {
+
+    double ratio = getGearRatio();
+    double inertia = ROTOR_INERTIA * ratio * ratio + loadInertia;
+
+    velocity += computeTorque(velocity) / inertia * dt;
+    angle += velocity * dt;
+}
+
+} // namespace sim
@@ -0,0 +1,143 @@
+#include "Simulation/World.h"
+#include <errno.h>
+#include <stdexcept>
+
+namespace sim {
+
+static thread_local World* activeWorld = nullptr;
+
+World::World(uint32_t physicsStepMicros):
+    scheduler(*this),
+    physicsStep(physicsStepMicros)
+{
+    previous = activeWorld;
+    activeWorld = this;
+}
+
+World::~World() {
+    scheduler.killAll();
+    activeWorld = previous;
+}
+
+World& World::current() {
+    if (!activeWorld) throw std::logic_error("PROS call made on a thread without a sim::World");
+    return *activeWorld;
+}
+
+bool World::exists() {
+    return activeWorld != nullptr;
+}
+
+void World::advanceTo(uint64_t time) {
+
+    while (physicsTime + physicsStep <= time) {
+
+        double dt = physicsStep / 1e6;
+        for (auto& device : ports) {
+            if (device && device->type == DeviceType::MOTOR) {
+                static_cast<SimMotor*>(device.get())->updateFirmware(dt, batteryVoltage);
+            }
+        }
+
+        for (Plant* plant : plants) plant->step(dt);
+
+        for (auto& device : ports) {
+            if (device && device->type == DeviceType::MOTOR) {
+                SimMotor* motor = static_cast<SimMotor*>(device.get());
+                if (!motor->attached) motor->stepFree(dt);
+            }
+        }
+
+        physicsTime += physicsStep;
+    }
+
+    if (time > now) now = time;
+}
+
+void World::charge(uint32_t micros) {
+    if (micros == 0) return;
+    SimTask* task = scheduler.current();
+    if (task) task->cpuTime += micros;
+    advanceTo(now + micros);
+}
+
+bool World::run(std::function<void()> program, double timeoutSeconds, const char* name) {
+
+    // The task keeps running past a timeout until a later run()/runFor() or the world's end, so it owns program
+    SimTask* task = scheduler.create(
+        [](void* parameters) { static_cast<SimTask*>(parameters)->program(); },
+        nullptr, 8, name
+    );
+    task->parameters = task;
+    task->program = std::move(program);
+    return scheduler.runUntilDone(task, now + (uint64_t) (timeoutSeconds * 1e6));
+}
+
+void World::runFor(double seconds) {
+    scheduler.runUntil(now + (uint64_t) (seconds * 1e6));
+}
+
+template <class T>
+T* World::getDevice(uint8_t port, DeviceType type) {
+
+    if (port < 1 || port > SMART_PORT_COUNT) {
+        errno = ENXIO;
+        return nullptr;
+    }
+
+    std::unique_ptr<SmartDevice>& device = ports[port - 1];
+    if (!device) device.reset(new T());
+
+    if (device->type != type || !device->connected) {
+        errno = ENODEV;
+        return nullptr;
+    }
+    return static_cast<T*>(device.get());
+}
+
+SimMotor* World::getMotor(uint8_t port) {
+    return getDevice<SimMotor>(port, DeviceType::MOTOR);
+}
+
+SimImu* World::getImu(uint8_t port) {
+    return getDevice<SimImu>(port, DeviceType::IMU);
+}
+
+SimGps* World::getGps(uint8_t port) {
+    return getDevice<SimGps>(port, DeviceType::GPS);
+}
+
+SimAdiPort* World::getAdiPort(uint8_t port) {
+
+    if (port >= 'a' && port <= 'h') port -= 'a' - 1;
+    else if (port >= 'A' && port <= 'H') port -= 'A' - 1;
+
+    if (port < 1 || port > ADI_PORT_COUNT) {
+        errno = ENXIO;
+        return nullptr;
+    }
+    return &adi[port - 1];
+}
+
+std::vector<SimMotor*> World::getMotors() {
+    std::vector<SimMotor*> motors;
+    for (auto& device : ports) {
+        if (device && device->type == DeviceType::MOTOR) motors.push_back(static_cast<SimMotor*>(device.get()));
+    }
+    return motors;
+}
+
+void World::addPlant(Plant* plant) {
+    plants.push_back(plant);
+}
+
+void World::removePlant(Plant* plant) {
+    for (auto it = plants.begin(); it != plants.end(); it++) {
+        if (*it == plant) {
+            plants.erase(it);
+            return;
+        }
+    }
+}
+
+} // namespace sim
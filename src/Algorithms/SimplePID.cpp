@@ -1,12 +1,31 @@
 #include "Algorithms/SimplePID.h"
+#include "pros/rtos.hpp"
 #include "math.h"
 
+// Interval assumed for the first tick, when there is no previous timestamp. The motion loops run at 100 Hz
+static constexpr double FIRST_TICK_DT = 0.01;
+
+// Longest interval the I and D terms will integrate over, so a controller resumed after a pause doesn't
+// wind up or spike
+static constexpr double MAX_DT = 0.1;
+
 double SimplePID::tick(double error) {
 
   handleEndCondition(error);
 
-  double integral = prevIntegral + error * 0.02;
-  double derivative = (error - prevError) / 0.02;
+  uint64_t now = pros::micros();
+  double dt = ticked ? fmin((now - prevTime) / 1000000.0, MAX_DT) : FIRST_TICK_DT;
+  if (dt <= 0) dt = lastDt > 0 ? lastDt : FIRST_TICK_DT;
+  ticked = true;
+  prevTime = now;
+  lastDt = dt;
+
+  double integral = prevIntegral + error * dt;
+  double derivative = (error - prevError) / dt;
+  if (derivativeTimeConstant > 0) {
+    derivative = prevDerivative + (derivative - prevDerivative) * dt / (derivativeTimeConstant + dt);
+  }
+  prevDerivative = derivative;
 
   double output = K.P * error + K.I * integral + K.D * derivative;
   prevError = error;
@@ -34,4 +53,12 @@ void SimplePID::setNewParam(double kp, double ki, double kd){
 
 double SimplePID::getCurrentError() {
   return prevError;
+}
+
+void SimplePID::setDerivativeFilter(double timeConstant) {
+  derivativeTimeConstant = timeConstant;
+}
+
+double SimplePID::getLastDt() {
+  return lastDt;
 }
\ No newline at end of file
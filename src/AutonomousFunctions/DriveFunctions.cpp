@@ -1,7 +1,10 @@
 
 
 #include "AutonomousFunctions/DriveFunctions.h"
+#include "Subsystems/RobotBuilder.h"
+#include "misc/Display.h"
 #include "misc/MathUtility.h"
+#include "misc/Telemetry.h"
 #include "pros/rtos.hpp"
 
 // Check if targetHeading was set to default, in which case maintain the current heading and update targetHeading value
@@ -9,6 +12,9 @@ inline void setHeading(Robot& robot, double& targetHeading) {
     if (targetHeading == MAINTAIN_CURRENT_HEADING) targetHeading = robot.localizer->getHeading();
 }
 
+// Each control loop iteration reads the sensors once with sampleSensors() and works from that snapshot, sharing
+// the executive's reads when it sampled in the same tick
+
 // Go forwards for some time while maintaining heading
 void goForwardTimedU(Robot& robot, SimplePID&& pidHeading, double timeSeconds, double targetEffort, double targetHeading) {
     
@@ -16,16 +22,19 @@ void goForwardTimedU(Robot& robot, SimplePID&& pidHeading, double timeSeconds, d
 
     uint32_t endTime = pros::millis() + timeSeconds * 1000;
 
+    PeriodicLoop loop(10, &robot.drive->motionTiming);
     while (pros::millis() < endTime) {
 
-        double headingError = deltaInHeading(targetHeading, robot.localizer->getHeading());
+        SensorSnapshot sensors = sampleSensors(robot, SENSE_LOCALIZER);
+        double headingError = deltaInHeading(targetHeading, robot.localizer->getHeading(sensors));
         double deltaVelocity = pidHeading.tick(headingError);
         
         double left = targetEffort - deltaVelocity;
         double right = targetEffort + deltaVelocity;
+        telemetry.log(TELEMETRY_MOTION, {0, (float) headingError, (float) left, (float) right});
         robot.drive->setEffort(left, right);
 
-        pros::delay(10);
+        loop.wait();
     }
 
     robot.drive->stop();
@@ -34,9 +43,11 @@ void goForwardTimedU(Robot& robot, SimplePID&& pidHeading, double timeSeconds, d
 void goForwardFast(Robot& robot, EndablePID&& pidDistance, SimplePID&& pidHeading, double fastDistance, double slowdownDistance, double targetHeading) {
     robot.drive->resetDistance();
     robot.drive->setEffort(1,1);
-    while (robot.drive->getDistance() < fastDistance) pros::delay(10);
+    PeriodicLoop loop(10, &robot.drive->motionTiming);
+    double distance = 0;
+    while ((distance = robot.drive->getDistance(sampleSensors(robot, SENSE_DRIVE))) < fastDistance) loop.wait();
     
-    double targetDistance = slowdownDistance + (fastDistance - robot.drive->getDistance());
+    double targetDistance = slowdownDistance + (fastDistance - distance);
     goForwardU(robot, std::move(pidDistance), std::move(pidHeading), targetDistance, targetHeading);
 }
 
@@ -52,10 +63,13 @@ double goForwardU(Robot& robot, EndablePID&& pidDistance, SimplePID&& pidHeading
     int32_t startTime = pros::millis();
 
     // FULL EXAMPLE FUNCTION
+    PeriodicLoop loop(10, &robot.drive->motionTiming);
     while (!pidDistance.isCompleted()/*  && pros::millis() - startTime < MAX_TIMEOUT*/) {
 
-        double baseVelocity = pidDistance.tick(distance - robot.drive->getDistance());
-        double headingError = deltaInHeading(targetHeading, robot.localizer->getHeading());
+        SensorSnapshot sensors = sampleSensors(robot);
+        double distanceError = distance - robot.drive->getDistance(sensors);
+        double baseVelocity = pidDistance.tick(distanceError);
+        double headingError = deltaInHeading(targetHeading, robot.localizer->getHeading(sensors));
         //pros::lcd::print(0, "Heading error: %f", headingError);
         //pros::lcd::print(1, "Target heading: %f", targetHeading);
         //pros::lcd::print(2, "Current heading: %f", robot.localizer->getHeading());
@@ -64,11 +78,10 @@ double goForwardU(Robot& robot, EndablePID&& pidDistance, SimplePID&& pidHeading
         double left = baseVelocity - deltaVelocity;
         double right = baseVelocity + deltaVelocity;
 
-        printf("%.2f %.2f\n", left, right);
-
+        telemetry.log(TELEMETRY_MOTION, {(float) distanceError, (float) headingError, (float) left, (float) right});
         robot.drive->setEffort(left, right);
 
-        pros::delay(10);
+        loop.wait();
     }
     if (pidDistance.stopMotors) robot.drive->stop();
     return distance - robot.drive->getDistance();
@@ -76,16 +89,19 @@ double goForwardU(Robot& robot, EndablePID&& pidDistance, SimplePID&& pidHeading
 
 // Turn to some given heading: left is positive
 void goTurnU(Robot& robot, EndablePID&& pidHeading, double absoluteHeading) {
+    PeriodicLoop loop(10, &robot.drive->motionTiming);
     while(!pidHeading.isCompleted()) {
-        double headingError = deltaInHeading(absoluteHeading, robot.localizer->getHeading());
+        SensorSnapshot sensors = sampleSensors(robot, SENSE_LOCALIZER);
+        double headingError = deltaInHeading(absoluteHeading, robot.localizer->getHeading(sensors));
         double turnVelocity = pidHeading.tick(headingError);
 
         double left = -turnVelocity;
         double right = turnVelocity;
+        telemetry.log(TELEMETRY_MOTION, {0, (float) headingError, (float) left, (float) right});
         robot.drive->setEffort(left, right);
         
 
-        pros::delay(10);
+        loop.wait();
     }
     
     robot.drive->stop();
@@ -109,8 +125,10 @@ void goCurveU(Robot& robot, EndablePID&& pidDistance, SimplePID&& pidCurve, doub
 
     robot.drive->resetDistance();
 
+    PeriodicLoop loop(10, &robot.drive->motionTiming);
     while (!pidDistance.isCompleted()) {
-        double largerDistanceCurrent = (deltaTheta > 0 != reverse) ? robot.drive->getRightDistance() : robot.drive->getLeftDistance();
+        SensorSnapshot sensors = sampleSensors(robot);
+        double largerDistanceCurrent = (deltaTheta > 0 != reverse) ? robot.drive->getRightDistance(sensors) : robot.drive->getLeftDistance(sensors);
         largerDistanceCurrent = fabs(largerDistanceCurrent);
         double distanceError = largerDistanceTotal - largerDistanceCurrent;
 
@@ -118,8 +136,8 @@ void goCurveU(Robot& robot, EndablePID&& pidDistance, SimplePID&& pidCurve, doub
         double slowerWheelSpeed = fasterWheelSpeed * slowerWheelRatio;
 
         double targetTheta = startTheta + deltaTheta * (largerDistanceCurrent / largerDistanceTotal);
-        pros::lcd::print(0, "Target degrees %f", getDegrees(targetTheta));
-        double headingError = deltaInHeading(targetTheta, robot.localizer->getHeading());
+        display.print(0, "Target degrees %f", getDegrees(targetTheta));
+        double headingError = deltaInHeading(targetTheta, robot.localizer->getHeading(sensors));
         double headingCorrection = pidCurve.tick(headingError);
 
         double left, right;
@@ -140,9 +158,10 @@ void goCurveU(Robot& robot, EndablePID&& pidDistance, SimplePID&& pidCurve, doub
         left -= headingCorrection; 
         right += headingCorrection;
 
+        telemetry.log(TELEMETRY_MOTION, {(float) distanceError, (float) headingError, (float) left, (float) right});
         robot.drive->setEffort(left, right);
 
-        pros::delay(10);
+        loop.wait();
     }
 
     if (pidDistance.stopMotors) robot.drive->stop();
@@ -152,17 +171,21 @@ void goCurveU(Robot& robot, EndablePID&& pidDistance, SimplePID&& pidCurve, doub
 // go to (x,y) through concurrently aiming at (x,y) and getting as close to it as possible
 void goToPoint(Robot& robot, EndablePID&& pidDistance, SimplePID&& pidHeading, double goalX, double goalY) {
 
-    double startX = robot.localizer->getX();
-    double startY = robot.localizer->getY();
+    PoseEstimate start = robot.localizer->getPose();
+    double startX = start.x;
+    double startY = start.y;
 
     double recalculateHeading = true;
     double targetHeading = headingToPoint(startX, startY, goalX, goalY);
 
+    PeriodicLoop loop(10, &robot.drive->motionTiming);
     while(!pidDistance.isCompleted()){
 
-        double x = robot.localizer->getX();
-        double y = robot.localizer->getY();
-        double h = robot.localizer->getHeading();
+        checkSubsystems(robot);
+        PoseEstimate pose = robot.localizer->getPose(); // one consistent update, not x, y and heading separately
+        double x = pose.x;
+        double y = pose.y;
+        double h = pose.heading;
 
         double otherX = x + cos(h);
         double otherY = y + sin(h);
@@ -178,14 +201,15 @@ void goToPoint(Robot& robot, EndablePID&& pidDistance, SimplePID&& pidHeading, d
         // pros::lcd::print(3, "other %.2f %.2f", otherX, otherY);
         double baseVelocity = pidDistance.tick(currentDistance);
 
-        double headingError = deltaInHeading(targetHeading, robot.localizer->getHeading());
+        double headingError = deltaInHeading(targetHeading, h);
         double deltaVelocity = pidHeading.tick(headingError);
 
         double left = baseVelocity - deltaVelocity;
         double right = baseVelocity + deltaVelocity;
+        telemetry.log(TELEMETRY_MOTION, {(float) currentDistance, (float) headingError, (float) left, (float) right});
         robot.drive->setEffort(left, right);
 
-        pros::delay(10);
+        loop.wait();
     }
     
     robot.drive->stop();
@@ -193,8 +217,9 @@ void goToPoint(Robot& robot, EndablePID&& pidDistance, SimplePID&& pidHeading, d
 
 void turnToPoint(Robot& robot, EndablePID&& pidHeading, double goalX, double goalY) {
 
-    double startX = robot.localizer->getX();
-    double startY = robot.localizer->getY();
+    PoseEstimate start = robot.localizer->getPose();
+    double startX = start.x;
+    double startY = start.y;
 
     double targetHeading = headingToPoint(startX, startY, goalX, goalY);
 
@@ -1,56 +1,59 @@
 #include "PathFollowing/AnselController.h"
+#include "misc/PeriodicLoop.h"
+#include "misc/Telemetry.h"
 #include "AutonomousFunctions/DriveFunctions.h"
+#include "Subsystems/RobotBuilder.h"
 #include "Algorithms/SimplePID.h"
 #include "Algorithms/SingleBoundedPID.h"
 
-#define LOOKAHEAD_DELTA 10 // in terms of waypoint indices
-#define LOOKAHEAD_SEARCH_RANGE 10 // the range to look for the closest/target waypoint
+#define LOOKAHEAD_DISTANCE 10 // inches along the path ahead of the closest point
 #define BASE_EFFORT 0.2 // base speed (0-1)
 #define HEADING_KP 7 // how much to compensate for heading error to target
 
-Waypoint AnselController::getTargetWaypoint(std::vector<Waypoint>& path, int& closestIndex, Waypoint& currentPosition) {
-
-    double closestDistance = distance(currentPosition, path[closestIndex]);
-    int maxIndex = closestIndex + LOOKAHEAD_SEARCH_RANGE;
-    for (int i = closestIndex + 1; i < path.size() && i < maxIndex; i++) {
-        double dist = distance(currentPosition, path[i]);
-        if (dist < closestDistance) {
-            closestIndex = i;
-            closestDistance = dist;
-        }
-    }
-    int targetIndex = fmin(closestIndex + LOOKAHEAD_DELTA, path.size() - 1);
-    return path[targetIndex];
-
+void AnselController::runSegment(std::vector<Waypoint>& path) {
+    runSegment(IndexedPath(path));
 }
 
-
 // Blocking method to run pure pursuit on the given path
-// When last lookahead point is reached, call goToPoint() instead
-void AnselController::runSegment(std::vector<Waypoint>& path) {
+// When the closest point is the last waypoint, call goToPoint() instead
+void AnselController::runSegment(const IndexedPath& path) {
+
+    if (path.size() < 2) return;
 
-    int closestIndex = 0;
-    Waypoint targetPosition;
+    const PathPoint& last = path[path.size() - 1];
+    const PathPoint& lastSegment = path[path.size() - 2];
+    int segment = 0;
+    PeriodicLoop loop(10, &robot->drive->motionTiming);
     while (true) {
 
-        Waypoint currentPosition = {robot->localizer->getX(), robot->localizer->getY()};
-        double currentHeading = robot->localizer->getHeading();
+        checkSubsystems(*robot);
+        PoseEstimate pose = robot->localizer->getPose();
+        Waypoint currentPosition = {pose.x, pose.y};
+        double currentHeading = pose.heading;
+
+        PathProjection closest = path.project(pose.x, pose.y, segment);
+        segment = closest.segment;
 
-        targetPosition = getTargetWaypoint(path, closestIndex, currentPosition);
+        // past the middle of the last segment, the last waypoint is the closest
+        if (closest.s >= lastSegment.s + lastSegment.length / 2) break;
 
-        if (closestIndex == path.size() - 1) break;
+        Waypoint targetPosition = path.pointAt(closest.s + LOOKAHEAD_DISTANCE, segment);
 
         double headingToTarget = thetaBetweenWaypoints(currentPosition, targetPosition);
         double headingError = deltaInHeading(headingToTarget, currentHeading);
 
-        double leftEffort = BASE_EFFORT + HEADING_KP * headingError;
-        double rightEffort = BASE_EFFORT - HEADING_KP * headingError;
+        // CCW positive: a target to the left needs the right side faster
+        double turn = invertedSteering ? -HEADING_KP * headingError : HEADING_KP * headingError;
+        double leftEffort = BASE_EFFORT - turn;
+        double rightEffort = BASE_EFFORT + turn;
 
+        telemetry.log(TELEMETRY_MOTION, {(float) (path.getLength() - closest.s), (float) headingError,
+            (float) leftEffort, (float) rightEffort});
         robot->drive->setEffort(leftEffort, rightEffort);
 
-        pros::delay(10);
+        loop.wait();
     }
-    
-    // go directly to last point once lookahead target becomes the last waypoint
-    goToPoint(*robot, SingleBoundedPID({1,0,0}), SimplePID({1,0,0}), targetPosition.x, targetPosition.y);
-}
\ No newline at end of file
+
+    // go directly to last point once it is the closest
+    goToPoint(*robot, SingleBoundedPID({1,0,0}), SimplePID({1,0,0}), last.x, last.y);
+}
@@ -0,0 +1,126 @@
+#include "PathFollowing/IndexedPath.h"
+#include "misc/MathUtility.h"
+
+IndexedPath::IndexedPath(const std::vector<Waypoint>& waypoints) {
+    owned.reserve(waypoints.size());
+    for (const Waypoint& w : waypoints) add(w.x, w.y);
+    index();
+}
+
+IndexedPath::IndexedPath(const float* x, const float* y, int count) {
+    owned.reserve(count);
+    for (int i = 0; i < count; i++) add(x[i], y[i]);
+    index();
+}
+
+void IndexedPath::add(double x, double y) {
+    if (!owned.empty() && x == owned.back().x && y == owned.back().y) return;
+    PathPoint point = {};
+    point.x = x;
+    point.y = y;
+    owned.push_back(point);
+}
+
+void IndexedPath::index() {
+
+    double s = 0;
+    for (size_t i = 0; i < owned.size(); i++) {
+        PathPoint& point = owned[i];
+        point.s = s;
+        if (i + 1 < owned.size()) {
+            double dx = owned[i + 1].x - point.x, dy = owned[i + 1].y - point.y;
+            point.length = sqrt(dx * dx + dy * dy);
+            point.tangentX = dx / point.length;
+            point.tangentY = dy / point.length;
+            s += point.length;
+        } else if (i > 0) {
+            point.tangentX = owned[i - 1].tangentX;
+            point.tangentY = owned[i - 1].tangentY;
+        } else {
+            point.tangentX = 1;
+        }
+    }
+
+    // Curvature of the circle through each point and its neighbors
+    for (size_t i = 1; i + 1 < owned.size(); i++) {
+        const PathPoint& a = owned[i - 1];
+        const PathPoint& b = owned[i];
+        const PathPoint& c = owned[i + 1];
+        double cross = (b.x - a.x) * (c.y - b.y) - (b.y - a.y) * (c.x - b.x);
+        double ac = getDistance(a.x, a.y, c.x, c.y);
+        owned[i].curvature = 2 * cross / (a.length * b.length * ac);
+    }
+
+    points = owned.data();
+    count = owned.size();
+}
+
+IndexedPath::IndexedPath(const PathPoint* points, int count): points(points), count(count) {}
+
+IndexedPath::IndexedPath(const IndexedPath& other): owned(other.owned), count(other.count) {
+    points = other.owned.empty() ? other.points : owned.data();
+}
+
+IndexedPath& IndexedPath::operator=(const IndexedPath& other) {
+    owned = other.owned;
+    points = other.owned.empty() ? other.points : owned.data();
+    count = other.count;
+    return *this;
+}
+
+PathProjection IndexedPath::project(double x, double y, int hint) const {
+
+    PathProjection best = {};
+    if (count == 0) return best;
+    if (count == 1) {
+        best.x = points[0].x;
+        best.y = points[0].y;
+        return best;
+    }
+
+    int last = count - 2; // segments end one before the last point
+    if (hint < 0) hint = 0;
+    if (hint > last) hint = last;
+
+    double bestDistance = POS_INF;
+    double limit = points[hint].s + PROJECTION_WINDOW;
+    for (int i = hint; i <= last && points[i].s <= limit; i++) {
+        const PathPoint& p = points[i];
+        double along = clamp((x - p.x) * p.tangentX + (y - p.y) * p.tangentY, 0, p.length);
+        double px = p.x + p.tangentX * along, py = p.y + p.tangentY * along;
+        double distance = getDistance(x, y, px, py);
+        if (distance < bestDistance) {
+            bestDistance = distance;
+            best.segment = i;
+            best.s = p.s + along;
+            best.x = px;
+            best.y = py;
+            best.crossTrack = p.tangentX * (y - p.y) - p.tangentY * (x - p.x);
+        }
+    }
+    return best;
+}
+
+int IndexedPath::segmentAt(double s, int hint) const {
+    int last = count - 2;
+    if (last < 0) return 0;
+    int i = hint < 0 ? 0 : hint > last ? last : hint;
+    while (i < last && points[i + 1].s <= s) i++;
+    return i;
+}
+
+Waypoint IndexedPath::pointAt(double s, int hint) const {
+    if (count == 0) return {0, 0};
+    if (s >= getLength()) return {points[count - 1].x, points[count - 1].y};
+    const PathPoint& p = points[segmentAt(s, hint)];
+    double along = fmax(s - p.s, 0);
+    return {p.x + p.tangentX * along, p.y + p.tangentY * along};
+}
+
+double IndexedPath::curvatureAt(double s, int hint) const {
+    if (count < 2) return 0;
+    int i = segmentAt(s, hint);
+    const PathPoint& p = points[i];
+    double fraction = clamp((s - p.s) / p.length, 0, 1);
+    return p.curvature + (points[i + 1].curvature - p.curvature) * fraction;
+}
@@ -0,0 +1,122 @@
+#include "PathFollowing/PathCache.h"
+#include "PathFollowing/RouteGenerator.h"
+#include "pros/misc.hpp"
+#include <cstdio>
+#include <cstring>
+
+PathCache pathCache;
+
+constexpr uint32_t ROUTE_FILE_MAGIC = 0x45545552; // "RUTE"
+
+// A saved route: this header, then its PathPoints
+typedef struct RouteFileHeader {
+    uint32_t magic;
+    uint32_t hash;
+    int32_t count;
+} RouteFileHeader;
+
+void PathCache::start(const RouteSpec* specs, int count, const char* sdPrefix, uint32_t taskPriority) {
+
+    if (task) return;
+
+    entryCount = count < MAX_ROUTES ? count : MAX_ROUTES;
+    for (int i = 0; i < entryCount; i++) {
+        entries[i].spec = &specs[i];
+        entries[i].hash = getRouteHash(specs[i]);
+    }
+    strncpy(prefix, sdPrefix, sizeof(prefix) - 1);
+
+    task.reset(new pros::Task([this] { fill(); }, taskPriority, TASK_STACK_DEPTH_DEFAULT, "Path cache"));
+}
+
+void PathCache::fill() {
+
+    for (int i = 0; i < entryCount; i++) {
+        Entry& entry = entries[i];
+        if (entry.ready) continue;
+
+        if (useTable(entry)) fromTables++;
+        else if (load(entry)) fromSd++;
+        else if (generate(entry)) {
+            generated++;
+            save(entry);
+        }
+        else continue; // a bad spec, which GenerateRoutes would have failed the build on
+
+        entry.ready.store(true, std::memory_order_release);
+    }
+    done = true;
+}
+
+bool PathCache::getPath(const char* name, IndexedPath& path) {
+    for (int i = 0; i < entryCount; i++) {
+        const Entry& entry = entries[i];
+        if (strcmp(entry.spec->name, name)) continue;
+        if (!entry.ready.load(std::memory_order_acquire)) return false;
+        path = IndexedPath(entry.points, entry.count);
+        return true;
+    }
+    return false;
+}
+
+bool PathCache::useTable(Entry& entry) {
+    const Route* route = getRoute(entry.spec->name);
+    if (!route || route->hash != entry.hash) return false;
+    entry.points = route->points;
+    entry.count = route->count;
+    return true;
+}
+
+bool PathCache::load(Entry& entry) {
+
+    if (!pros::usd::is_installed()) return false;
+
+    char path[48];
+    snprintf(path, sizeof(path), "%s%08x.bin", prefix, (unsigned) entry.hash);
+    FILE* file = fopen(path, "rb");
+    if (!file) return false;
+
+    RouteFileHeader header;
+    bool loaded = fread(&header, sizeof(header), 1, file) == 1 && header.magic == ROUTE_FILE_MAGIC
+        && header.hash == entry.hash && header.count >= 2 && header.count <= MAX_POINTS;
+    if (loaded) {
+        entry.storage.resize(header.count);
+        loaded = fread(entry.storage.data(), sizeof(PathPoint), header.count, file) == (size_t) header.count;
+    }
+    fclose(file);
+
+    if (!loaded) {
+        std::vector<PathPoint>().swap(entry.storage);
+        return false;
+    }
+    entry.points = entry.storage.data();
+    entry.count = header.count;
+    return true;
+}
+
+bool PathCache::generate(Entry& entry) {
+
+    if (!generateRoute(*entry.spec, entry.storage)) {
+        std::vector<PathPoint>().swap(entry.storage);
+        return false;
+    }
+    entry.storage.shrink_to_fit();
+    entry.points = entry.storage.data();
+    entry.count = entry.storage.size();
+    return true;
+}
+
+void PathCache::save(const Entry& entry) {
+
+    if (!pros::usd::is_installed()) return;
+
+    char path[48];
+    snprintf(path, sizeof(path), "%s%08x.bin", prefix, (unsigned) entry.hash);
+    FILE* file = fopen(path, "wb");
+    if (!file) return;
+
+    RouteFileHeader header = {ROUTE_FILE_MAGIC, entry.hash, entry.count};
+    fwrite(&header, sizeof(header), 1, file);
+    fwrite(entry.points, sizeof(PathPoint), entry.count, file);
+    fclose(file);
+}
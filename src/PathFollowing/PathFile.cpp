@@ -0,0 +1,96 @@
+#include "PathFollowing/PathFile.h"
+#include <cstdio>
+#include <cstring>
+
+bool PathFile::load(const char* path) {
+
+    FILE* file = fopen(path, "rb");
+    if (!file) return false;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    std::unique_ptr<uint8_t[]> bytes;
+    bool read = size > 0;
+    if (read) {
+        bytes.reset(new uint8_t[size]);
+        read = fread(bytes.get(), 1, size, file) == (size_t) size;
+    }
+    fclose(file);
+
+    if (!read) {
+        clear();
+        return false;
+    }
+    return load(std::move(bytes), size);
+}
+
+bool PathFile::load(std::unique_ptr<uint8_t[]> bytes, uint32_t byteCount) {
+
+    clear();
+    if (!bytes || byteCount < sizeof(PathFileHeader)) return false;
+
+    const PathFileHeader* h = (const PathFileHeader*) bytes.get();
+    if (h->magic != PATH_FILE_MAGIC || h->version != PATH_FILE_VERSION || h->size != byteCount) return false;
+
+    uint64_t tableEnd = sizeof(PathFileHeader) + (uint64_t) h->segmentCount * sizeof(PathFileSegment);
+    if (tableEnd + (uint64_t) h->pointCount * sizeof(float) * PATH_FILE_ARRAYS != byteCount) return false;
+
+    const PathFileSegment* table = (const PathFileSegment*) (bytes.get() + sizeof(PathFileHeader));
+    for (int i = 0; i < h->segmentCount; i++) {
+        if ((uint64_t) table[i].first + table[i].count > h->pointCount) return false;
+    }
+
+    data = std::move(bytes);
+    header = h;
+    segments = table;
+    for (int i = 0; i < PATH_FILE_ARRAYS; i++) arrays[i] = (const float*) (data.get() + tableEnd) + i * h->pointCount;
+    return true;
+}
+
+std::vector<uint8_t> PathFile::encode(const std::vector<std::vector<PathFilePoint>>& segmentPoints) {
+
+    PathFileHeader h;
+    h.magic = PATH_FILE_MAGIC;
+    h.version = PATH_FILE_VERSION;
+    h.segmentCount = segmentPoints.size();
+    h.pointCount = 0;
+    for (const std::vector<PathFilePoint>& segment : segmentPoints) h.pointCount += segment.size();
+
+    uint32_t tableEnd = sizeof(PathFileHeader) + h.segmentCount * sizeof(PathFileSegment);
+    h.size = tableEnd + h.pointCount * sizeof(float) * PATH_FILE_ARRAYS;
+
+    std::vector<uint8_t> bytes(h.size);
+    memcpy(bytes.data(), &h, sizeof(h));
+
+    PathFileSegment* table = (PathFileSegment*) (bytes.data() + sizeof(PathFileHeader));
+    float* x = (float*) (bytes.data() + tableEnd);
+    float* y = x + h.pointCount;
+
+    uint32_t point = 0;
+    for (int i = 0; i < h.segmentCount; i++) {
+        table[i] = {point, (uint32_t) segmentPoints[i].size()};
+        for (const PathFilePoint& p : segmentPoints[i]) {
+            x[point] = p.x;
+            y[point] = p.y;
+            point++;
+        }
+    }
+    return bytes;
+}
+
+PathSegmentView PathFile::getSegment(int index) const {
+
+    if (index < 0 || index >= getSegmentCount()) return {0, nullptr, nullptr};
+
+    uint32_t first = segments[index].first;
+    return {segments[index].count, arrays[0] + first, arrays[1] + first};
+}
+
+void PathFile::clear() {
+    data.reset();
+    header = nullptr;
+    segments = nullptr;
+    for (int i = 0; i < PATH_FILE_ARRAYS; i++) arrays[i] = nullptr;
+}
@@ -1,6 +1,45 @@
 #include "PathFollowing/PathFollower.h"
+#include "PathFollowing/RouteGenerator.h"
+#include "misc/Display.h"
+#include <cstring>
+
+bool PathFollower::loadPath(const char* sdPath) {
+
+    PathFile file;
+    if (!file.load(sdPath)) return false;
+
+    std::vector<IndexedPath> segments;
+    segments.reserve(file.getSegmentCount());
+    for (int i = 0; i < file.getSegmentCount(); i++) {
+        PathSegmentView segment = file.getSegment(i);
+        segments.emplace_back(segment.x, segment.y, segment.count);
+    }
+    path = std::move(segments);
+    return true;
+}
 
 // Blocking function that runs a segment of the path given the index and the controller
 void PathFollower::runSegment(int index) {
+    if (index < 0 || index >= (int) path.size()) return;
     controller->runSegment(path[index]);
-}
\ No newline at end of file
+}
+
+bool PathFollower::runRoute(const char* name) {
+    IndexedPath route;
+    if (pathCache.getPath(name, route)) {
+        controller->runSegment(route);
+        return true;
+    }
+
+    // Never worth waiting for generation, but never drive a table out of date with RouteSpecs.h either
+    const Route* table = getRoute(name);
+    if (!table) return false;
+    for (const RouteSpec& spec : ROUTE_SPECS) {
+        if (!strcmp(spec.name, name) && getRouteHash(spec) != table->hash) {
+            display.print(7, "Route %s stale, not driven", name);
+            return false;
+        }
+    }
+    controller->runSegment(getPath(*table));
+    return true;
+}
@@ -0,0 +1,76 @@
+#include "PathFollowing/RouteGenerator.h"
+#include <math.h>
+#include <cstring>
+
+static constexpr int SPLINE_SAMPLES = 1000; // per spline, before resampling by arc length
+
+static uint32_t hashBytes(uint32_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = (const uint8_t*) data;
+    for (size_t i = 0; i < size; i++) hash = (hash ^ bytes[i]) * 16777619; // FNV-1a
+    return hash;
+}
+
+uint32_t getRouteHash(const RouteSpec& spec) {
+    uint32_t hash = 2166136261u;
+    hash = hashBytes(hash, &ROUTE_GENERATOR_VERSION, sizeof(ROUTE_GENERATOR_VERSION));
+    hash = hashBytes(hash, spec.name, strlen(spec.name));
+    hash = hashBytes(hash, &spec.poseCount, sizeof(spec.poseCount));
+    for (int i = 0; i < spec.poseCount && i < RouteSpec::MAX_POSES; i++) {
+        hash = hashBytes(hash, &spec.poses[i], sizeof(RoutePose));
+    }
+    return hash;
+}
+
+// Quintic Hermite spline from a to b with zero second derivatives at the ends. Its end derivatives point along
+// the poses' headings, as long as the chord between them
+static Waypoint evaluateSpline(const RoutePose& a, const RoutePose& b, double t) {
+
+    double chord = hypot(b.x - a.x, b.y - a.y);
+    double t3 = t * t * t, t4 = t3 * t, t5 = t4 * t;
+    double h0 = 1 - 10 * t3 + 15 * t4 - 6 * t5;
+    double h1 = t - 6 * t3 + 8 * t4 - 3 * t5;
+    double h4 = -4 * t3 + 7 * t4 - 3 * t5;
+    double h5 = 10 * t3 - 15 * t4 + 6 * t5;
+
+    double ha = a.heading * M_PI / 180, hb = b.heading * M_PI / 180;
+    return {h0 * a.x + h1 * chord * cos(ha) + h4 * chord * cos(hb) + h5 * b.x,
+        h0 * a.y + h1 * chord * sin(ha) + h4 * chord * sin(hb) + h5 * b.y};
+}
+
+// Points every ROUTE_SPACING inches along the splines, and the route's last pose
+static std::vector<Waypoint> sample(const RouteSpec& spec) {
+
+    std::vector<Waypoint> dense = {{spec.poses[0].x, spec.poses[0].y}};
+    for (int i = 0; i + 1 < spec.poseCount; i++) {
+        for (int j = 1; j <= SPLINE_SAMPLES; j++) {
+            dense.push_back(evaluateSpline(spec.poses[i], spec.poses[i + 1], (double) j / SPLINE_SAMPLES));
+        }
+    }
+
+    std::vector<Waypoint> points = {dense[0]};
+    double s = 0, next = ROUTE_SPACING;
+    for (size_t i = 1; i < dense.size(); i++) {
+        double length = hypot(dense[i].x - dense[i - 1].x, dense[i].y - dense[i - 1].y);
+        while (length > 0 && s + length >= next) {
+            double fraction = (next - s) / length;
+            points.push_back({dense[i - 1].x + (dense[i].x - dense[i - 1].x) * fraction,
+                dense[i - 1].y + (dense[i].y - dense[i - 1].y) * fraction});
+            next += ROUTE_SPACING;
+        }
+        s += length;
+    }
+    if (points.size() > 1 && s + ROUTE_SPACING / 2 < next) points.pop_back(); // no sliver before the last pose
+    points.push_back(dense.back());
+    return points;
+}
+
+bool generateRoute(const RouteSpec& spec, std::vector<PathPoint>& points) {
+
+    if (spec.poseCount < 2 || spec.poseCount > RouteSpec::MAX_POSES) return false;
+
+    IndexedPath path(sample(spec));
+    if (path.size() < 2) return false;
+
+    points.assign(&path[0], &path[0] + path.size());
+    return true;
+}
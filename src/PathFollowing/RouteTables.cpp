@@ -0,0 +1,81 @@
+// Generated by sim/programs/GenerateRoutes from include/PathFollowing/RouteSpecs.h. Do not edit
+
+#include "PathFollowing/Routes.h"
+
+// threeTileCurve: 40.9 in
+static constexpr PathPoint ROUTE_0_POINTS[] = {
+    {21.47, 61.87, 0, 0.9358045784, -0.3525192067, 0.9999999585, 0},
+    {22.40580454, 61.51748081, 0.9999999585, 0.936471103, -0.3507447409, 0.9999996685, 0.001895517174},
+    {23.34227533, 61.16673618, 1.999999627, 0.9377521894, -0.3473050984, 0.9999991458, 0.003670468451},
+    {24.28002672, 60.81943138, 2.999998773, 0.9395837309, -0.3423191679, 0.9999984521, 0.00531169607},
+    {25.219609, 60.47711274, 3.999997225, 0.9418975756, -0.335900219, 0.9999976321, 0.006823266378},
+    {26.16150434, 60.14121332, 4.999994857, 0.9446193179, -0.3281681645, 0.9999967296, 0.008197129204},
+    {27.10612057, 59.81304623, 5.999991587, 0.9476774572, -0.3192294427, 0.9999957983, 0.009447413956},
+    {28.05379405, 59.49381813, 6.999987385, 0.9510018715, -0.3091851232, 0.9999948518, 0.01058022358},
+    {29.00479102, 59.1846346, 7.999982237, 0.9545207772, -0.2981444046, 0.9999939284, 0.01158799686},
+    {29.959306, 58.886492, 8.999976165, 0.958173059, -0.2861894286, 0.9999930387, 0.01250050594},
+    {30.91747239, 58.60030457, 9.999969204, 0.9618936871, -0.2734237273, 0.9999921951, 0.01329694763},
+    {31.87935857, 58.32688297, 10.9999614, 0.9656292245, -0.2599234518, 0.9999914295, 0.01400767252},
+    {32.84497952, 58.06696175, 11.99995283, 0.9693276997, -0.2457718668, 0.9999907203, 0.01462702624},
+    {33.81429823, 57.82119216, 12.99994355, 0.9729413353, -0.2310522844, 0.9999900916, 0.01515680953},
+    {34.78722992, 57.59014217, 13.99993364, 0.9764301616, -0.2158335922, 0.9999895695, 0.01561363061},
+    {35.7636499, 57.37431083, 14.99992321, 0.9797583713, -0.2001837504, 0.9999891063, 0.0159999996},
+    {36.7433976, 57.17412926, 15.99991232, 0.9828920665, -0.1841824793, 0.9999887053, 0.01630541686},
+    {37.72627856, 56.98994886, 16.99990102, 0.9858055254, -0.167891233, 0.9999884099, 0.01654990083},
+    {38.71207266, 56.82205957, 17.99988943, 0.9884762748, -0.1513758707, 0.999988217, 0.01673011167},
+    {39.70053729, 56.67068548, 18.99987765, 0.9908863666, -0.13470044, 0.9999881172, 0.01684889467},
+    {40.69141188, 56.53598664, 19.99986577, 0.9930222785, -0.1179269032, 0.9999880751, 0.01690918283},
+    {41.68442232, 56.41806115, 20.99985384, 0.9948735246, -0.101127, 0.9999880972, 0.01690179474},
+    {42.679284, 56.31693535, 21.99984194, 0.9964352157, -0.08436148968, 0.9999882189, 0.01683828763},
+    {43.67570748, 56.23257485, 22.99983016, 0.9977059745, -0.06769629566, 0.9999884414, 0.01671376796},
+    {44.67340192, 56.16487934, 23.9998186, 0.9986884785, -0.05119885715, 0.9999887672, 0.01652685743},
+    {45.67207918, 56.11368106, 24.99980737, 0.9993896525, -0.03493311429, 0.9999891553, 0.01628102846},
+    {46.67145799, 56.07874832, 25.99979652, 0.9998198486, -0.01898078625, 0.9999896019, 0.01595829717},
+    {47.67126745, 56.05976773, 26.99978612, 0.9999941738, -0.003413544337, 0.9999901522, 0.01556837554},
+    {48.67125177, 56.05635422, 27.99977627, 0.9999316324, 0.01169318334, 0.9999908001, 0.01510700102},
+    {49.6711742, 56.0680473, 28.99976708, 0.9996551718, 0.02625904707, 0.999991504, 0.01456861601},
+    {50.67082088, 56.09430612, 29.99975858, 0.9991921873, 0.04018672447, 0.9999922798, 0.01393548354},
+    {51.67000536, 56.13449254, 30.99975086, 0.998573342, 0.05339738464, 0.9999931243, 0.01322524346},
+    {52.66857183, 56.18788956, 31.99974398, 0.9978338936, 0.06578389448, 0.9999940152, 0.01240864175},
+    {53.66639975, 56.25367306, 32.999738, 0.9970116612, 0.07725119682, 0.9999949431, 0.01149680601},
+    {54.66340637, 56.33092386, 33.99973294, 0.996148267, 0.08768483464, 0.9999958909, 0.01046934823},
+    {55.65955055, 56.41860834, 34.99972883, 0.9952863555, 0.09697974301, 0.9999968243, 0.009334819111},
+    {56.65483374, 56.51558777, 35.99972566, 0.9944714448, 0.1050073592, 0.9999977106, 0.00806889442},
+    {57.64930291, 56.62059489, 36.99972337, 0.9937476019, 0.1116499155, 0.9999985238, 0.006681891216},
+    {58.64304905, 56.73224464, 37.99972189, 0.9931577706, 0.1167803185, 0.9999992057, 0.005164203442},
+    {59.63620603, 56.84902487, 38.9997211, 0.9927418789, 0.1202645499, 0.9999997064, 0.003508966761},
+    {60.62894761, 56.96928938, 39.9997208, 0.9925361156, 0.1219510527, 0.9078283109, 0.00178109193},
+    {61.53, 57.08, 40.90754911, 0.9925361156, 0.1219510527, 0, 0},
+};
+
+// twoTileS: 19.7 in
+static constexpr PathPoint ROUTE_1_POINTS[] = {
+    {78.33, 59.24, 0, -0.4388097606, -0.8985799875, 0.9998747788, 0},
+    {77.89124519, 58.34153253, 0.9998747788, -0.3571443167, -0.9340492155, 0.999428024, 0.0890664956},
+    {77.53430515, 57.40801757, 1.999302803, -0.2336070505, -0.9723310887, 0.9992066063, 0.1294210951},
+    {77.30088344, 56.43645792, 2.998509409, -0.0953081577, -0.9954478164, 0.9991650274, 0.1403318255},
+    {77.20565486, 55.44184128, 3.997674437, 0.04611220355, -0.9989362666, 0.9991653301, 0.1415815752},
+    {77.25172858, 54.4437388, 4.996839767, 0.1865935853, -0.9824371908, 0.9991661484, 0.1415650467},
+    {77.43816657, 53.46212081, 5.996005915, 0.3215606217, -0.9468889938, 0.9992233522, 0.1396824446},
+    {77.75947745, 52.51596722, 6.995229267, 0.4380096588, -0.8989702658, 0.9994835413, 0.1260043923},
+    {78.1972609, 51.61746123, 7.994712809, 0.5077737643, -0.8614904551, 0.9999283497, 0.07921778049},
+    {78.70499828, 50.7560325, 8.994641158, 0.5018219419, -0.8649709467, 0.9999072397, -0.006895348379},
+    {79.20677367, 49.89114179, 9.994548398, 0.4391382254, -0.8984195117, 0.9996521793, -0.07106531939},
+    {79.64575916, 48.99303477, 10.99420058, 0.3454411957, -0.9384403978, 0.9994957297, -0.1019296608},
+    {79.99102616, 48.0550676, 11.99369631, 0.2371967521, -0.9714616311, 0.9994454992, -0.1132291135},
+    {80.22809138, 47.08414464, 12.99314181, 0.1233601378, -0.9923619684, 0.9994394802, -0.1158039192},
+    {80.35138238, 46.09233891, 13.99258129, 0.007704269372, -0.9999703217, 0.999439342, -0.1159708658},
+    {80.35908233, 45.09292923, 14.99202063, -0.1082235393, -0.9941265843, 0.9994369981, -0.116140253},
+    {80.25091972, 44.09936234, 15.99145763, -0.2222510308, -0.9749894765, 0.9994528156, -0.1156864365},
+    {80.0287903, 43.12490637, 16.99091044, -0.3285858279, -0.9444741149, 0.9995391774, -0.1106825278},
+    {79.70035589, 42.18086749, 17.99044962, -0.4147319728, -0.9099436195, 0.9997505365, -0.09284198796},
+    {79.28572738, 41.27115086, 18.99020016, -0.4582651016, -0.8888155583, 0.7326051604, -0.05586497453},
+    {78.95, 40.62, 19.72280532, -0.4582651016, -0.8888155583, 0, 0},
+};
+
+const Route ROUTES[] = {
+    {"threeTileCurve", ROUTE_0_POINTS, 42, 0x529aa4fc},
+    {"twoTileS", ROUTE_1_POINTS, 21, 0x97b87a7e},
+};
+
+const int ROUTE_COUNT = 2;
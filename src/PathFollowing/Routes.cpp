@@ -0,0 +1,9 @@
+#include "PathFollowing/Routes.h"
+#include <cstring>
+
+const Route* getRoute(const char* name) {
+    for (int i = 0; i < ROUTE_COUNT; i++) {
+        if (!strcmp(ROUTES[i].name, name)) return &ROUTES[i];
+    }
+    return nullptr;
+}
@@ -1,6 +1,7 @@
 #include "Subsystems/RobotBuilder.h"
 #include "Programs/Driver.h"
 #include "AutonomousFunctions/DriveFunctions.h"
+#include "AutonomousFunctions/PIDPresets.h"
 #include "Algorithms/SingleBoundedPID.h"
 #include "Algorithms/SimplePID.h"
 #include "Algorithms/DoubleBoundedPID.h"
@@ -13,25 +14,6 @@
 #include "pros/llemu.hpp"
 #include "pros/rtos.hpp"
 
-// for cata momentum
-#define GFU_DIST_FAST(maxSpeed) DoubleBoundedPID({0.17, 0, 0.017, 0.12, maxSpeed}, 0.075, 3, false)
-
-// for normal forwards
-#define GFU_DIST_PRECISE(maxSpeed) DoubleBoundedPID({0.123, 0, 0.027, 0.12, clamp(maxSpeed,-0.8,0.8), 0.03}, 0.075, 3)
-
-
-#define GFU_TURN SimplePID({1, 1.5, 0, 0.0, 1})
-#define GTU_TURN DoubleBoundedPID({1.25, 0.00, 0.095, 0.15, 1}, getRadians(1.5), 1)
-
-#define GTU_TURN_PRECISE DoubleBoundedPID({1.25, 0.005, 0.13, 0.17, 1}, getRadians(0.5), 3)
-
-#define GCU_CURVE SimplePID({2.5/*2.25*//*1.7*/, 0, 0})
-
-#define NO_CORRECTION SimplePID({0,0,0})
-
-// don't stop motors at end
-#define NO_SLOWDOWN(maxSpeed) NoPID(maxSpeed)
-
 void startIntake(Robot& robot) {
     pros::delay(300);
     setEffort(*robot.intake, 1);
@@ -1,4 +1,5 @@
 #include "Programs/CompetitionDriver.h"
+#include "misc/Display.h"
 #include "misc/ProsUtility.h"
 #include "pros/llemu.hpp"
 #include "pros/motors.h"
@@ -6,6 +7,7 @@
 
 void CompetitionDriver::runDriver() {
     pros::lcd::initialize();
+    display.start();
     robot.drive->setBrakeMode(pros::E_MOTOR_BRAKE_COAST);
 
     initDriver();
@@ -16,6 +18,7 @@ void CompetitionDriver::runDriver() {
     //     });
     // }
 
+    PeriodicLoop loop(10, &loopTiming);
     while (true) {
 
         // Handle drivetrain locomotion from joysticks (tank, arcade, etc.)
@@ -27,8 +30,8 @@ void CompetitionDriver::runDriver() {
         // Update button state machine for rising and falling edges
         controller.updateButtonState();
 
-        // Enforce minimum polling cycle rate
-        pros::delay(10);
+        // Hold a fixed polling cycle rate
+        loop.wait();
     }
 }
 
@@ -1,4 +1,6 @@
 #include "Programs/FlywheelDriver.h"
+#include "Subsystems/RobotBuilder.h"
+#include "misc/Display.h"
 #include "misc/ProsUtility.h"
 #include "pros/llemu.hpp"
 #include "pros/motors.h"
@@ -8,18 +10,17 @@ void FlywheelDriver::initDriver() {
     // Reinitialize flap position
     robot.shooterFlap->set_value(flapUp);
 
-    if (true && robot.flywheel) {
-        pros::Task taskFlywheel([&] {
-            robot.flywheel->maintainVelocityTask();
-        });
-    }
+    scheduleFlywheel(robot);
+
+    display.setGraphRange(0, 3600);
 }
 
 void FlywheelDriver::handleSecondaryActions() {
 
-    pros::lcd::clear();
-    pros::lcd::print(0, "Flywheel target velocity: %.2f", robot.flywheel->getTargetVelocity());
-    pros::lcd::print(1, "Flywheel actual velocity: %.2f", robot.flywheel->getCurrentVelocity());
+    display.clear();
+    display.print(0, "Flywheel target velocity: %.2f", robot.flywheel->getTargetVelocity());
+    display.print(1, "Flywheel actual velocity: %.2f", robot.flywheel->getCurrentVelocity());
+    display.plot(robot.flywheel->getCurrentVelocity());
 
     // Flywheel Speed Controls
     if (controller.pressed(DIGITAL_UP)) {
@@ -1,4 +1,5 @@
 #include "Programs/TuningDriver.h"
+#include "misc/Display.h"
 #include "misc/ProsUtility.h"
 #include "pros/llemu.hpp"
 #include "pros/motors.h"
@@ -9,6 +10,7 @@
 void TuningDriver::runDriver() {
 
     pros::lcd::initialize();
+    display.start();
 
     robot.drive->setBrakeMode(pros::E_MOTOR_BRAKE_BRAKE);
 
@@ -36,11 +38,11 @@ void TuningDriver::runDriver() {
 
 void TuningDriver::drawAdjustableParameters(int line, int numParams, int selectedParam, std::vector<double>& paramValues, std::vector<std::string>& paramNames, TestData& data) {
     
-    pros::lcd::clear();
+    display.clear();
 
     // display data for previous run
-    pros::lcd::print(0, "Time: %f", data.time);
-    pros::lcd::print(1, "Error: %f", data.error);
+    display.print(0, "Time: %f", data.time);
+    display.print(1, "Error: %f", data.error);
 
     // display the adjustable parameters
     std::string str;
@@ -51,7 +53,7 @@ void TuningDriver::drawAdjustableParameters(int line, int numParams, int selecte
 
         str += paramNames[i] + ": " + std::to_string(paramValues[i]);
 
-        pros::lcd::print(line, str.c_str());
+        display.print(line, "%s", str.c_str());
 
         line++;
         }
@@ -1,4 +1,5 @@
 #include "Subsystems/Drive/Drive.h"
+#include "misc/Display.h"
 
 
 Drive::Drive(std::initializer_list<int8_t> left, std::initializer_list<int8_t> right, pros::motor_gearset_e_t internalGearRatio, double externalGearRatio, double wheelDiameterInches, double trackWidthInches):
@@ -17,9 +18,8 @@ Drive::Drive(std::initializer_list<int8_t> left, std::initializer_list<int8_t> r
 
 // bounded -1 to 1
 void Drive::setEffort(double left, double right) {
-    pros::lcd::clear();
-    pros::lcd::print(0, "%.2f %.2f", left, right);
-    leftMotors.move_voltage(left * 12000); // take in millivolts
+    display.print(0, "%.2f %.2f", left, right);
+    leftMotors.move_voltage(left * 12000); // take in millivolts. Repeats of the last command are not sent
     rightMotors.move_voltage(right * 12000);
 }
 
@@ -73,6 +73,19 @@ double Drive::getDistance() {
     return (getLeftDistance() + getRightDistance()) / 2.0;
 }
 
+void Drive::sample(SensorSnapshot& snapshot) {
+    snapshot.leftPosition = _getMotorDistance(leftMotors);
+    snapshot.rightPosition = _getMotorDistance(rightMotors);
+}
+
+double Drive::getLeftDistance(const SensorSnapshot& snapshot) { return snapshot.leftPosition - leftPositionAtZero; }
+
+double Drive::getRightDistance(const SensorSnapshot& snapshot) { return snapshot.rightPosition - rightPositionAtZero; }
+
+double Drive::getDistance(const SensorSnapshot& snapshot) {
+    return (getLeftDistance(snapshot) + getRightDistance(snapshot)) / 2.0;
+}
+
 // get motor current for motor group in amps
 double Drive::_getMotorCurrent(pros::MotorGroup& motors) {
 
@@ -95,4 +108,11 @@ double Drive::getCurrent() {
     double left = _getMotorCurrent(leftMotors);
     double right = _getMotorCurrent(rightMotors);
     return (left + right) / 2.0;
-}
\ No newline at end of file
+}
+
+MotorOutputStats Drive::getOutputStats() {
+    MotorOutputStats stats = leftMotors.getOutputStats();
+    stats.written += rightMotors.getOutputStats().written;
+    stats.suppressed += rightMotors.getOutputStats().suppressed;
+    return stats;
+}
@@ -1,4 +1,5 @@
 #include "Subsystems/Flywheel/Flywheel.h"
+#include "misc/Telemetry.h"
 #include "pros/llemu.hpp"
 
 
@@ -14,7 +15,38 @@ double Flywheel::getTargetVelocity() {
 }
 
 double Flywheel::getCurrentVelocity() {
-    return motors.get_actual_velocities()[0] * ratio;
+    return getVelocitySample().rpm;
+}
+
+FlywheelSample Flywheel::sampleVelocity() {
+
+    FlywheelSample sample;
+    sample.time = pros::micros();
+    sample.motorCount = portCount;
+
+    double total = 0;
+    for (int i = 0; i < portCount; i++) {
+        sample.motorVelocity[i] = pros::c::motor_get_actual_velocity(ports[i]); // no vector, unlike the group call
+        total += sample.motorVelocity[i];
+    }
+    sample.rpm = sample.motorVelocity[0] * ratio;
+    if (portCount > 0) sample.averageRPM = total / portCount * ratio;
+
+    sampleMutex.take();
+    latest = sample;
+    sampleMutex.give();
+
+    return sample;
+}
+
+FlywheelSample Flywheel::getVelocitySample() {
+
+    sampleMutex.take();
+    FlywheelSample sample = latest;
+    sampleMutex.give();
+
+    bool fresh = sample.time != 0 && pros::micros() - sample.time < SAMPLE_MAX_AGE;
+    return fresh ? sample : sampleVelocity();
 }
 
 bool Flywheel::atTargetVelocity() {
@@ -26,18 +58,26 @@ void Flywheel::maintainVelocityTask() {
     if (isOn) return;
     isOn = true;
     
+    PeriodicLoop loop(10, &loopTiming);
     while (true) {
+        maintainVelocity();
+        loop.wait();
+    }
+}
+
+void Flywheel::maintainVelocity() {
+
+    isOn = true; // a controller is running, so maintainVelocityTask() won't start a second one
 
-        if (targetRPM == 0 && !hasSetStopped) {
-            motors.brake();
-            hasSetStopped = true;
-        } else if (targetRPM != 0) {
-            float currentRPM = getCurrentVelocity();
-            //pros::lcd::print(0, "flywheel: %f", getCurrentVelocity());
-            targetVoltage = getNextMotorVoltage(currentRPM);
-            motors.move_voltage(targetVoltage * 1000); // millivolts
-        }
-        pros::delay(10);
+    if (targetRPM == 0 && !hasSetStopped) {
+        motors.brake();
+        hasSetStopped = true;
+    } else if (targetRPM != 0) {
+        float currentRPM = sampleVelocity().rpm;
+        //pros::lcd::print(0, "flywheel: %f", getCurrentVelocity());
+        targetVoltage = getNextMotorVoltage(currentRPM);
+        motors.move_voltage(targetVoltage * 1000); // millivolts
+        telemetry.log(TELEMETRY_FLYWHEEL, {(float) targetRPM, currentRPM, (float) targetVoltage});
     }
 }
 
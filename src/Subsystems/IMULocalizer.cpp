@@ -1,24 +1,60 @@
 #include "Subsystems/Localizer/IMULocalizer.h"
+#include "misc/Display.h"
 #include "misc/MathUtility.h"
 #include <stdexcept>
 
 
 double IMULocalizer::getHeading() {
+    return getImuHeading().heading;
+}
+
+double IMULocalizer::getHeading(const SensorSnapshot& snapshot) {
+    return snapshot.imuHeading;
+}
+
+void IMULocalizer::sample(SensorSnapshot& snapshot) {
 
-    return getRawHeading();
+    ImuHeading imu = getImuHeading();
+    snapshot.imuHeadingA = imu.headingA;
+    snapshot.imuHeadingB = imu.headingB;
+    snapshot.imuValidA = imu.validA;
+    snapshot.imuValidB = imu.validB;
+    snapshot.imuHeading = imu.heading;
+}
 
+void IMULocalizer::sampleImus() {
+    readImus();
+    lastPeriodicSample = (uint32_t) pros::micros() | 1; // never 0 once it has run
 }
 
-double IMULocalizer::getRawHeading() { // radians
+ImuHeading IMULocalizer::getImuHeading() {
+
+    ImuHeading imu = imuHeading.read();
 
+    // Without the periodic sampler, sample on demand, at most once per MAX_AGE however many callers there are
+    uint64_t now = pros::micros();
+    uint32_t last = lastPeriodicSample;
+    bool samplerRunning = last != 0 && (uint32_t) now - last < 3 * SAMPLE_PERIOD * 1000;
+    if (!samplerRunning && (imu.time == 0 || now - imu.time >= MAX_AGE)) imu = readImus();
 
-    double headingA = -getRadians(imuA.get_heading());
-    qA.push(headingA);
+    if (!imu.validA && !imu.validB) throw std::runtime_error("Both IMU disconnect.");
+    return imu;
+}
 
-    double headingB = -getRadians(imuB.get_heading());
-    qB.push(headingB);
+// Read both IMUs once and average the ones still working
+ImuHeading IMULocalizer::readImus() {
+
+    imuMutex.take();
+
+    ImuHeading imu;
+    imu.time = pros::micros();
+
+    imu.headingA = -getRadians(imuA.get_heading());
+    qA.push(imu.headingA);
+
+    imu.headingB = -getRadians(imuB.get_heading());
+    qB.push(imu.headingB);
 
-    
     if (qA.isAllEqual()) {
         imuValidA = false;
     }
@@ -26,12 +62,20 @@ double IMULocalizer::getRawHeading() { // radians
         imuValidB = false;
     }
 
-    if (!imuValidA && !imuValidB) throw std::runtime_error("Both IMU disconnect.");
-    else if (!imuValidA) return headingB;
-    else if (!imuValidB) return headingA;
+    imu.validA = imuValidA;
+    imu.validB = imuValidB;
+
+    if (!imuValidA) imu.heading = imu.headingB;
+    else if (!imuValidB) imu.heading = imu.headingA;
+    else {
+        double avg = imu.headingA + deltaInHeading(imu.headingB, imu.headingA) / 2.0;
+        imu.heading = fmod(fmod(avg, 2*M_PI) + 2*M_PI, 2*M_PI);
+    }
+
+    imuHeading.write(imu);
+    imuMutex.give();
 
-    double avg = headingA + deltaInHeading(headingB, headingA) / 2.0;
-    return fmod(fmod(avg, 2*M_PI) + 2*M_PI, 2*M_PI);
+    return imu;
 }
     
 void IMULocalizer::updatePositionTask() { // blocking task used to update (x, y, heading)
@@ -39,7 +83,7 @@ void IMULocalizer::updatePositionTask() { // blocking task used to update (x, y,
 }
 
 void IMULocalizer::init() {
-    pros::lcd::print(0, "Initialization start.");
+    display.print(0, "Initialization start.");
     pros::delay(500);
     imuA.reset(false);
     imuB.reset(true);
@@ -50,14 +94,14 @@ void IMULocalizer::init() {
 
     if (imuA.get_heading() == POS_INF) {
         imuValidA = false;
-        pros::lcd::print(1, "IMU A disconnected. Still operational if IMU B is connected.");
+        display.print(1, "IMU A disconnected. Still operational if IMU B is connected.");
     }
     if (imuB.get_heading() == POS_INF) {
         imuValidB = false;
-        pros::lcd::print(1, "IMU B disconnected. Still operational if IMU A is connected.");
+        display.print(1, "IMU B disconnected. Still operational if IMU A is connected.");
     }
 
-    pros::lcd::print(0, "Initialization complete.");
+    display.print(0, "Initialization complete.");
 
 }
 
@@ -66,8 +110,10 @@ void IMULocalizer::setPosition(double x, double y) {
 }
 
 void IMULocalizer::setHeading(double headingRadians) {
+    resets++;
     double d = getDegrees(-headingRadians);
     d = fmod(fmod(d, 360) + 360, 360);
     imuA.set_heading(d);
     imuB.set_heading(d);
+    readImus(); // so the cached heading doesn't lag the change
 }
\ No newline at end of file
@@ -1,120 +1,153 @@
 #include "Subsystems/Localizer/Odometry.h"
+#include "misc/Display.h"
 #include "misc/MathUtility.h"
+#include "misc/Telemetry.h"
 #include <stdexcept>
 
 
 double Odometry::getX() { // inches
-    return currentX;
+    return pose.read().x;
 }
 
 double Odometry::getY() { // inches
-    return currentY;
+    return pose.read().y;
 }
 
 double Odometry::getHeading() {
+    return getPose().heading;
+}
+
+PoseEstimate Odometry::getPose() {
 
     if (!imuValidA && !imuValidB) throw std::runtime_error("Both IMU disconnect.");
-    return currentHeading;
+    return pose.read();
+}
 
+void Odometry::publishPose(uint64_t time) {
+    PoseEstimate estimate;
+    estimate.x = filter.currentX;
+    estimate.y = filter.currentY;
+    estimate.heading = filter.currentHeading;
+    estimate.time = time;
+    estimate.sequence = pose.getWrites() + 1;
+    pose.write(estimate);
 }
     
 void Odometry::updatePositionTask() { // blocking task used to update (x, y, heading)
 
-    if (isOn) return;
-    isOn = true;
-
+    if (filter.started) return; // already being updated, e.g. by the executive
 
     try {
+        PeriodicLoop loop(updatePeriod, &loopTiming);
+        while (true) {
+            update();
+            printStatus();
+            loop.wait();
+        }
+    } catch (std::runtime_error &e) {
+        // nothing, stopping motors handled in main thread
+    }
 
-        drive.resetDistance();
-        prevLeftDistance = 0;
-        prevRightDistance = 0;
-        prevHeading = getRawHeading();
+}
 
-        double gpsX, gpsY, gpsHeading;
-        double biasX = 0, biasY = 0, biasHeading = 0;
+void Odometry::setUpdatePeriod(uint32_t periodMs) {
 
-        const double K_POSITION = 0.03;
-        const double K_HEADING = 0.01;
+    updatePeriod = periodMs ? periodMs : 1;
 
-        pros::screen::set_pen(0x00FF0000);
+    // Both sensors report in multiples of 5 ms. Reporting faster than 10 ms only helps if updates are that fast
+    uint32_t dataRate = updatePeriod < DEFAULT_UPDATE_PERIOD ? HIGH_RATE_PERIOD : DEFAULT_UPDATE_PERIOD;
+    imuA.set_data_rate(dataRate);
+    imuB.set_data_rate(dataRate);
+    gps.set_data_rate(dataRate);
+}
 
-        while (true) {
+void Odometry::sample(SensorSnapshot& snapshot) {
 
-            pros::screen::erase();
-            pros::lcd::clear();
-
-            if (gps.get_error() > 0.015) {
-                pros::screen::fill_rect(0, 0, 200, 200);
-            }
-
-            pros::lcd::print(0, "Filtered: %.2f %.2f %.2f",currentX, currentY, currentHeading);
-            pros::lcd::print(1, "Odom/IMU: %.2f %.2f %.2f", odomX, odomY, getRawHeading());
-            pros::lcd::print(2, "Individual IMU: %.2f %.2f", -getRadians(imuA.get_heading()), -getRadians(imuB.get_heading()));
-            pros::lcd::print(3, "GPS: %.2f %.2f %.2f", gpsX, gpsY, gpsHeading);
-            pros::lcd::print(4, "Bias: %.2f %.2f %.2f", biasX, biasY, biasHeading);
-
-            pros::lcd::print(5, "GPS error: %f", gps.get_error());
-
-            pros::delay(10);
-
-            double left = drive.getLeftDistance();
-            double right = drive.getRightDistance();
-            double heading = getRawHeading();
-
-            double deltaLeft = left - prevLeftDistance;
-            double deltaRight = right - prevRightDistance;
-            double deltaHeading = heading - prevHeading;
-
-            double arcLength = (deltaLeft + deltaRight) / 2;
-            if (deltaHeading == 0) {
-                // rare case where robot moved perfectly straight this tick
-                odomX += arcLength * cos(heading);
-                odomY += arcLength * sin(heading);
-
-            } else {
-                // The robot moved in an arc with radius = arcLength / deltaTheta
-                double radius = arcLength / deltaHeading;
-                odomX += radius * (cos(heading) - cos(prevHeading));
-                odomY += radius * (sin(heading) - sin(prevHeading));
-            }
-            
-            prevLeftDistance = left;
-            prevRightDistance = right;
-            prevHeading = heading;
-
-            // Calculate gps
-            pros::c::gps_status_s_t status = gps.get_status();
-            gpsX = status.x * METERS_TO_INCHES;
-            gpsY = status.y * METERS_TO_INCHES;
-            gpsHeading = fmod(-status.yaw + 360, 360) * M_PI / 180;
-
-            // Find filtered position
-            currentX = odomX + biasX;
-            currentY = odomY + biasY;
-            currentHeading = heading + biasHeading;
-
-            // Update bias from gps
-            if (gps.get_error() < 0.015) { // we found that, below this value, gps reads stable values
-                biasX += (gpsX - currentX) * K_POSITION;
-                biasY += (gpsY - currentY) * K_POSITION;
-                biasHeading += deltaInHeading(gpsHeading, currentHeading) * K_HEADING;
-            }
-        
-
-            pros::delay(10);
-        }
-    } catch (std::runtime_error &e) {
-        // nothing, stopping motors handled in main thread
+    IMULocalizer::sample(snapshot);
+
+    pros::c::gps_status_s_t status = gps.get_status();
+    snapshot.hasGps = true;
+    snapshot.gpsX = status.x * METERS_TO_INCHES;
+    snapshot.gpsY = status.y * METERS_TO_INCHES;
+    snapshot.gpsHeading = fmod(-status.yaw + 360, 360) * M_PI / 180;
+    snapshot.gpsError = gps.get_error();
+}
+
+void Odometry::update() {
+
+    SensorSnapshot snapshot;
+    snapshot.time = pros::micros();
+    drive.sample(snapshot);
+    sample(snapshot);
+    update(snapshot);
+}
+
+void Odometry::update(const SensorSnapshot& snapshot) {
+
+    filterMutex.take();
+    if (!filter.started) {
+        telemetry.log(TELEMETRY_ODOMETRY_START, {(float) filter.currentX, (float) filter.currentY,
+            (float) filter.isPositionKnown()});
     }
+    filter.update(snapshot);
+    publishPose(snapshot.time);
+    filterMutex.give();
+    lastSnapshot = snapshot;
+
+    // Everything the filter used, so the run can be replayed on the host. sampleAge (us before the record's time)
+    // recovers snapshot.time, which the filter's dt and GPS latency come from
+    uint32_t logTime = pros::micros();
+    telemetry.log(TELEMETRY_SENSORS, logTime, {(float) snapshot.leftPosition, (float) snapshot.rightPosition,
+        (float) snapshot.imuHeading, (float) snapshot.gpsX, (float) snapshot.gpsY, (float) snapshot.gpsHeading,
+        (float) snapshot.gpsError, (float) snapshot.imuHeadingA, (float) snapshot.imuHeadingB,
+        (float) snapshot.imuValidA, (float) snapshot.imuValidB, (float) (logTime - (uint32_t) snapshot.time)});
+    telemetry.log(TELEMETRY_ODOMETRY, {(float) filter.currentX, (float) filter.currentY,
+        (float) filter.currentHeading, (float) snapshot.imuHeading, (float) snapshot.gpsX, (float) snapshot.gpsY});
+}
+
+void Odometry::printStatus() {
 
+    const SensorSnapshot& s = lastSnapshot;
 
+    display.setAlert(s.gpsError > 0.015);
+
+    display.print(0, "Filtered: %.2f %.2f %.2f", filter.currentX, filter.currentY, filter.currentHeading);
+    display.print(1, "Std dev: %.2f %.2f %.2f", filter.getStdDev(PoseEKF::X), filter.getStdDev(PoseEKF::Y),
+        filter.getStdDev(PoseEKF::HEADING));
+    display.print(2, "Individual IMU: %.2f %.2f", s.imuHeadingA, s.imuHeadingB);
+    display.print(3, "GPS: %.2f %.2f %.2f", s.gpsX, s.gpsY, s.gpsHeading);
+    display.print(4, "Gyro bias: %.3f deg/s, GPS used %u gated %u", getDegrees(filter.getGyroBias()),
+        (unsigned) filter.getGpsUsed(), (unsigned) filter.getGpsGated());
+
+    display.print(5, "GPS error: %f", s.gpsError);
 }
 
 
 void Odometry::setPosition(double x, double y) {
-    currentX = x;
-    odomX = x;
-    currentY = y;
-    odomY = y;
+    filterMutex.take();
+    resets++;
+    filter.setPosition(x, y);
+    publishPose(pros::micros());
+    telemetry.log(TELEMETRY_ODOMETRY_SET_POSITION, {(float) x, (float) y});
+    filterMutex.give();
+}
+
+void Odometry::setHeading(double headingRadians) {
+
+    filterMutex.take();
+    IMULocalizer::setHeading(headingRadians); // sets both IMUs and samples them again
+
+    ImuHeading imu = imuHeading.read();
+    SensorSnapshot imus;
+    imus.imuHeading = imu.heading;
+    imus.imuHeadingA = imu.headingA;
+    imus.imuHeadingB = imu.headingB;
+    imus.imuValidA = imu.validA;
+    imus.imuValidB = imu.validB;
+
+    filter.setHeading(headingRadians, imus);
+    publishPose(pros::micros());
+    telemetry.log(TELEMETRY_ODOMETRY_SET_HEADING, {(float) headingRadians, (float) imus.imuHeading,
+        (float) imus.imuHeadingA, (float) imus.imuHeadingB, (float) imus.imuValidA, (float) imus.imuValidB});
+    filterMutex.give();
 }
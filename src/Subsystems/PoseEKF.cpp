@@ -0,0 +1,303 @@
+#include "Subsystems/Localizer/PoseEKF.h"
+#include "misc/MathUtility.h"
+
+// Until setPosition() or the GPS says otherwise the robot could be anywhere on the field
+static const double UNKNOWN_POSITION_STD_DEV = 144;
+static const double SET_POSITION_STD_DEV = 0.5;
+static const double START_HEADING_STD_DEV = 0.05;
+static const double START_GYRO_BIAS_STD_DEV = 0.005;
+static const double START_VELOCITY_STD_DEV = 1;
+
+static double wrapHeading(double heading) {
+    heading = fmod(heading, 2 * M_PI);
+    return heading < 0 ? heading + 2 * M_PI : heading;
+}
+
+void PoseEKF::update(const SensorSnapshot& snapshot) {
+
+    // Wheel travel since power on rather than since resetDistance(), so the motion functions resetting the
+    // drive distance don't show up as a jump in position
+    if (!started) {
+        start(snapshot);
+        return;
+    }
+
+    double dt = (snapshot.time - prevTime) / 1000000.0;
+    if (dt <= 0) dt = 0.001; // two updates in the same microsecond
+
+    double distance = (snapshot.leftPosition - prevLeftDistance + snapshot.rightPosition - prevRightDistance) / 2;
+    double imuTurn = deltaInHeading(snapshot.imuHeading, prevImuHeading);
+
+    // With both IMUs on, how far apart their turns are this tick measures how noisy they are right now
+    double imuDisagreement = 0;
+    bool bothImus = snapshot.imuValidA && snapshot.imuValidB;
+    if (bothImus && prevBothImus) {
+        double turnA = deltaInHeading(snapshot.imuHeadingA, prevImuHeadingA);
+        double turnB = deltaInHeading(snapshot.imuHeadingB, prevImuHeadingB);
+        imuTurn = (turnA + turnB) / 2;
+        imuDisagreement = (turnA - turnB) / 2;
+    }
+
+    predict(distance, imuTurn, imuDisagreement, dt);
+    correctVelocity(distance / dt);
+    pushStep(snapshot.time, distance, imuTurn, imuDisagreement, dt);
+    correctGps(snapshot);
+    publish();
+
+    prevTime = snapshot.time;
+    prevLeftDistance = snapshot.leftPosition;
+    prevRightDistance = snapshot.rightPosition;
+    prevImuHeading = snapshot.imuHeading;
+    prevImuHeadingA = snapshot.imuHeadingA;
+    prevImuHeadingB = snapshot.imuHeadingB;
+    prevBothImus = bothImus;
+}
+
+void PoseEKF::start(const SensorSnapshot& snapshot) {
+
+    started = true;
+    prevTime = snapshot.time;
+    prevLeftDistance = snapshot.leftPosition;
+    prevRightDistance = snapshot.rightPosition;
+    prevImuHeading = snapshot.imuHeading;
+    prevImuHeadingA = snapshot.imuHeadingA;
+    prevImuHeadingB = snapshot.imuHeadingB;
+    prevBothImus = snapshot.imuValidA && snapshot.imuValidB;
+
+    // Field heading starts as the IMU heading, like OdometryFilter, for the GPS to correct
+    double positionStdDev = positionKnown ? SET_POSITION_STD_DEV : UNKNOWN_POSITION_STD_DEV;
+    state(HEADING, 0) = snapshot.imuHeading;
+    state(GYRO_BIAS, 0) = 0;
+    state(VELOCITY, 0) = 0;
+
+    covariance = Matrix<STATES, STATES>();
+    covariance(X, X) = covariance(Y, Y) = positionStdDev * positionStdDev;
+    covariance(HEADING, HEADING) = START_HEADING_STD_DEV * START_HEADING_STD_DEV;
+    covariance(GYRO_BIAS, GYRO_BIAS) = START_GYRO_BIAS_STD_DEV * START_GYRO_BIAS_STD_DEV;
+    covariance(VELOCITY, VELOCITY) = START_VELOCITY_STD_DEV * START_VELOCITY_STD_DEV;
+
+    steps.clear();
+    pushStep(snapshot.time, 0, 0, 0, 0);
+    correctGps(snapshot);
+    publish();
+}
+
+// Moves along the arc driven this tick, see integrateArc()
+void PoseEKF::predict(double distance, double imuTurn, double imuDisagreement, double dt) {
+
+    double heading = state(HEADING, 0);
+    double turn = imuTurn - state(GYRO_BIAS, 0) * dt;
+    double chord = distance * sinc(turn / 2);
+    double midHeading = heading + turn / 2;
+    double c = cos(midHeading), s = sin(midHeading);
+
+    state(X, 0) += chord * c;
+    state(Y, 0) += chord * s;
+    state(HEADING, 0) = wrapHeading(heading + turn);
+
+    Matrix<STATES, STATES> jacobian = Matrix<STATES, STATES>::identity();
+    // Leaving out how the chord length depends on the bias, which is third order in the turn
+    jacobian(X, HEADING) = -chord * s;
+    jacobian(X, GYRO_BIAS) = chord * s * dt / 2;
+    jacobian(Y, HEADING) = chord * c;
+    jacobian(Y, GYRO_BIAS) = -chord * c * dt / 2;
+    jacobian(HEADING, GYRO_BIAS) = -dt;
+
+    // Wheel slip is along the direction of travel; sideways error comes from the heading
+    double slip = noise.wheelSlip * fabs(distance) + noise.wheelFloor;
+    double turnError = noise.imuTurn * fabs(imuTurn);
+    Matrix<STATES, STATES> process;
+    process(X, X) = slip * slip * c * c + noise.wheelFloor * noise.wheelFloor;
+    process(Y, Y) = slip * slip * s * s + noise.wheelFloor * noise.wheelFloor;
+    process(X, Y) = process(Y, X) = slip * slip * c * s;
+    process(HEADING, HEADING) = turnError * turnError + imuDisagreement * imuDisagreement
+        + noise.imuDrift * noise.imuDrift * dt;
+    process(GYRO_BIAS, GYRO_BIAS) = noise.gyroBiasDrift * noise.gyroBiasDrift * dt;
+    process(VELOCITY, VELOCITY) = noise.acceleration * noise.acceleration * dt;
+
+    covariance = jacobian * covariance * jacobian.transpose() + process;
+}
+
+void PoseEKF::correctVelocity(double velocity) {
+
+    // Scalar measurement of one state, so no matrix inverse
+    double innovationVariance = covariance(VELOCITY, VELOCITY) + noise.encoderVelocity * noise.encoderVelocity;
+    double innovation = velocity - state(VELOCITY, 0);
+
+    double gain[STATES], row[STATES];
+    for (int i = 0; i < STATES; i++) {
+        gain[i] = covariance(i, VELOCITY) / innovationVariance;
+        row[i] = covariance(VELOCITY, i);
+    }
+    for (int i = 0; i < STATES; i++) {
+        state(i, 0) += gain[i] * innovation;
+        for (int j = 0; j < STATES; j++) covariance(i, j) -= gain[i] * row[j];
+    }
+}
+
+void PoseEKF::correctGps(const SensorSnapshot& snapshot) {
+
+    if (!snapshot.hasGps || snapshot.gpsError >= noise.gpsErrorLimit) return;
+
+    // The GPS updates slower than the loop; using a repeated reading twice would overweight it
+    if (snapshot.gpsX == prevGpsX && snapshot.gpsY == prevGpsY && snapshot.gpsHeading == prevGpsHeading) return;
+    prevGpsX = snapshot.gpsX;
+    prevGpsY = snapshot.gpsY;
+    prevGpsHeading = snapshot.gpsHeading;
+
+    double positionStdDev = fmax(snapshot.gpsError * METERS_TO_INCHES, noise.gpsPositionFloor);
+    Matrix<3, 3> measurementNoise;
+    measurementNoise(0, 0) = measurementNoise(1, 1) = positionStdDev * positionStdDev;
+    measurementNoise(2, 2) = noise.gpsHeading * noise.gpsHeading;
+
+    Matrix<3, 1> measurement;
+    measurement(0, 0) = snapshot.gpsX;
+    measurement(1, 0) = snapshot.gpsY;
+    measurement(2, 0) = snapshot.gpsHeading;
+
+    uint64_t latency = (uint64_t) (noise.gpsLatency * 1000000);
+    int index = snapshot.time > latency ? steps.find(snapshot.time - latency) : -1;
+    if (index < 0 || index == (int) steps.size() - 1) {
+        // No latency, or older than the history: the best we can do is treat it as current
+        if (fuseGps(measurement, measurementNoise) && steps.size()) {
+            steps[steps.size() - 1].state = state;
+            steps[steps.size() - 1].covariance = covariance;
+        }
+        return;
+    }
+
+    // Fuse at the last update before the reading was measured, moving the reading back by however far the robot
+    // went between that update and the reading
+    Step& measured = steps[index];
+    const Step& next = steps[index + 1];
+    double fraction = next.time > measured.time
+        ? (double) (snapshot.time - latency - measured.time) / (next.time - measured.time) : 0;
+    measurement(0, 0) -= (next.state(X, 0) - measured.state(X, 0)) * fraction;
+    measurement(1, 0) -= (next.state(Y, 0) - measured.state(Y, 0)) * fraction;
+    measurement(2, 0) -= deltaInHeading(next.state(HEADING, 0), measured.state(HEADING, 0)) * fraction;
+
+    state = measured.state;
+    covariance = measured.covariance;
+    if (!fuseGps(measurement, measurementNoise)) {
+        state = steps.back().state;
+        covariance = steps.back().covariance;
+        return;
+    }
+
+    // Redo the updates since from the corrected estimate
+    measured.state = state;
+    measured.covariance = covariance;
+    for (uint32_t i = index + 1; i < steps.size(); i++) {
+        Step& step = steps[i];
+        predict(step.distance, step.imuTurn, step.imuDisagreement, step.dt);
+        correctVelocity(step.distance / step.dt);
+        step.state = state;
+        step.covariance = covariance;
+    }
+}
+
+// Returns whether the estimate changed
+bool PoseEKF::fuseGps(const Matrix<3, 1>& measurement, const Matrix<3, 3>& measurementNoise) {
+
+    Matrix<3, 1> innovation;
+    innovation(0, 0) = measurement(0, 0) - state(X, 0);
+    innovation(1, 0) = measurement(1, 0) - state(Y, 0);
+    innovation(2, 0) = deltaInHeading(measurement(2, 0), state(HEADING, 0));
+
+    // The GPS measures the first three states directly, so H P H' is the top left of P and P H' its first columns
+    Matrix<STATES, 3> crossCovariance;
+    Matrix<3, 3> innovationCovariance;
+    for (int i = 0; i < STATES; i++) {
+        for (int j = 0; j < 3; j++) crossCovariance(i, j) = covariance(i, j);
+    }
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) innovationCovariance(i, j) = covariance(i, j) + measurementNoise(i, j);
+    }
+
+    Matrix<3, 3> inverse;
+    if (!invert(innovationCovariance, inverse)) return false;
+
+    // Reject readings too far from the estimate to be believable, e.g. the GPS seeing a reflection. If they keep
+    // disagreeing it's the estimate that is wrong, so start over from the GPS
+    double distanceSquared = (innovation.transpose() * inverse * innovation)(0, 0);
+    if (distanceSquared > noise.gpsGate) {
+        gpsGated++;
+        if (++gatedInRow < noise.gpsReacquire) return false;
+
+        state(X, 0) = measurement(0, 0);
+        state(Y, 0) = measurement(1, 0);
+        state(HEADING, 0) = wrapHeading(measurement(2, 0));
+        for (int i = 0; i < STATES; i++) {
+            for (int j = 0; j < 3; j++) covariance(i, j) = covariance(j, i) = 0;
+        }
+        for (int i = 0; i < 3; i++) covariance(i, i) = measurementNoise(i, i);
+        gatedInRow = 0;
+        return true;
+    }
+    gatedInRow = 0;
+    gpsUsed++;
+
+    Matrix<STATES, 3> gain = crossCovariance * inverse;
+    state = state + gain * innovation;
+    state(HEADING, 0) = wrapHeading(state(HEADING, 0));
+
+    // Joseph form, which keeps the covariance symmetric and positive through rounding
+    Matrix<STATES, STATES> reduction = Matrix<STATES, STATES>::identity();
+    for (int i = 0; i < STATES; i++) {
+        for (int j = 0; j < 3; j++) reduction(i, j) -= gain(i, j);
+    }
+    covariance = reduction * covariance * reduction.transpose() + gain * measurementNoise * gain.transpose();
+    return true;
+}
+
+void PoseEKF::pushStep(uint64_t time, double distance, double imuTurn, double imuDisagreement, double dt) {
+    Step step;
+    step.time = time;
+    step.distance = distance;
+    step.imuTurn = imuTurn;
+    step.imuDisagreement = imuDisagreement;
+    step.dt = dt;
+    step.state = state;
+    step.covariance = covariance;
+    steps.push(step);
+}
+
+void PoseEKF::publish() {
+    currentX = state(X, 0);
+    currentY = state(Y, 0);
+    currentHeading = state(HEADING, 0);
+}
+
+void PoseEKF::setPosition(double x, double y) {
+
+    state(X, 0) = currentX = x;
+    state(Y, 0) = currentY = y;
+    positionKnown = true;
+    steps.clear(); // the robot didn't drive from the old position, so there is nothing to redo
+
+    for (int i = 0; i < STATES; i++) {
+        covariance(X, i) = covariance(i, X) = 0;
+        covariance(Y, i) = covariance(i, Y) = 0;
+    }
+    covariance(X, X) = covariance(Y, Y) = SET_POSITION_STD_DEV * SET_POSITION_STD_DEV;
+}
+
+void PoseEKF::setHeading(double heading, const SensorSnapshot& imus) {
+
+    if (!started) return; // start() takes the heading from the IMUs
+
+    state(HEADING, 0) = currentHeading = wrapHeading(heading);
+    prevImuHeading = imus.imuHeading;
+    prevImuHeadingA = imus.imuHeadingA;
+    prevImuHeadingB = imus.imuHeadingB;
+    prevBothImus = imus.imuValidA && imus.imuValidB;
+    steps.clear(); // a GPS reading from before the change would undo it
+
+    // As certain of the heading as at the start. The gyro bias estimate stands: the IMUs drift just the same
+    for (int i = 0; i < STATES; i++) covariance(HEADING, i) = covariance(i, HEADING) = 0;
+    covariance(HEADING, HEADING) = START_HEADING_STD_DEV * START_HEADING_STD_DEV;
+}
+
+double PoseEKF::getStdDev(StateIndex index) const {
+    return sqrt(covariance(index, index));
+}
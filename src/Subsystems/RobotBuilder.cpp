@@ -6,6 +6,8 @@
 #include "Subsystems/Flywheel/VoltageFlywheel.h"
 
 #include "pros/motors.h"
+#include <stdexcept>
+#include <stdio.h>
 
 // flywheel
 Robot getRobot15(bool isSkills) {
@@ -83,12 +85,12 @@ Robot getRobot15(bool isSkills) {
         0.00005 // tbh constant
     ));
 
-    robot.intake.reset(new pros::MotorGroup({-11, 16}));
+    robot.intake.reset(new CachedMotorGroup({-11, 16}));
     robot.intake->set_brake_modes(pros::E_MOTOR_BRAKE_BRAKE);
 
     robot.indexer.reset(new pros::ADIDigitalOut('A'));
 
-    robot.roller.reset(new pros::Motor(10, pros::E_MOTOR_GEAR_100));
+    robot.roller.reset(new CachedMotor(10, pros::E_MOTOR_GEAR_100));
     robot.roller->set_encoder_units(pros::E_MOTOR_ENCODER_DEGREES);
 
     robot.shooterFlap.reset(new pros::ADIDigitalOut('H'));
@@ -120,15 +122,15 @@ Robot getRobot18(bool isSkills) {
         9 // imu port B
     ));
 
-    robot.cata.reset(new pros::MotorGroup({16, -17}));
+    robot.cata.reset(new CachedMotorGroup({16, -17}));
     robot.cata->set_brake_modes(pros::E_MOTOR_BRAKE_HOLD);
 
     robot.limitSwitch.reset(new pros::ADIDigitalIn('A'));
 
-    robot.intake.reset(new pros::MotorGroup({-19, 20}));
+    robot.intake.reset(new CachedMotorGroup({-19, 20}));
     robot.intake->set_brake_modes(pros::E_MOTOR_BRAKE_BRAKE);
 
-    robot.roller.reset(new pros::Motor(18, pros::E_MOTOR_GEAR_100));
+    robot.roller.reset(new CachedMotor(18, pros::E_MOTOR_GEAR_100));
     robot.roller->set_encoder_units(pros::E_MOTOR_ENCODER_DEGREES);
 
 
@@ -136,4 +138,52 @@ Robot getRobot18(bool isSkills) {
 
     return robot;
 
-}
\ No newline at end of file
+}
+
+SensorSnapshot sampleSensors(Robot& robot, uint8_t groups) {
+    checkSubsystems(robot);
+    return robot.sensors->get(*robot.drive, *robot.localizer, groups);
+}
+
+void checkSubsystems(Robot& robot) {
+
+    CallbackStats stopped;
+    if (!robot.executive->getStopped(stopped)) return;
+
+    char message[sizeof(stopped.stopReason) + 32];
+    snprintf(message, sizeof(message), "%s stopped: %s", stopped.name, stopped.stopReason);
+    throw std::runtime_error(message);
+}
+
+void scheduleLocalizer(Robot& robot) {
+
+    if (!robot.localizer) return;
+
+    Drive* drive = robot.drive.get();
+    Localizer* localizer = robot.localizer.get();
+    SensorSampler* sensors = robot.sensors.get();
+    uint32_t period = localizer->hasUpdate() ? localizer->getUpdatePeriod() : IMULocalizer::SAMPLE_PERIOD;
+    // The IMUs are read once per tick here; everything else gets the cached heading
+    if (localizer->hasImus()) {
+        uint32_t imuPeriod = period < IMULocalizer::SAMPLE_PERIOD ? period : IMULocalizer::SAMPLE_PERIOD;
+        robot.executive->add("IMU", imuPeriod, Executive::SENSORS, [=] { localizer->sampleImus(); });
+    }
+    // Sampling every tick only pays off if the localizer consumes it. Otherwise the motion loops sample what they need
+    if (localizer->hasUpdate()) {
+        robot.executive->add("Sensors", period, Executive::SENSORS, [=] { sensors->sample(*drive, *localizer); });
+        robot.executive->add("Localizer", period, Executive::LOCALIZATION, [=] {
+            localizer->update(sensors->get(*drive, *localizer));
+        });
+    }
+    robot.executive->add("Localizer status", 100, Executive::DISPLAY, [localizer] { localizer->printStatus(); });
+    robot.executive->start();
+}
+
+void scheduleFlywheel(Robot& robot) {
+
+    if (!robot.flywheel) return;
+
+    Flywheel* flywheel = robot.flywheel.get();
+    robot.executive->add("Flywheel", 10, Executive::CONTROL, [flywheel] { flywheel->maintainVelocity(); });
+    robot.executive->start();
+}
@@ -0,0 +1,31 @@
+#include "Subsystems/SensorSampler.h"
+
+SensorSnapshot SensorSampler::get(Drive& drive, Localizer& localizer, uint8_t groups) {
+
+    mutex.take();
+    bool fresh = hasSample && pros::micros() - latest.time < MAX_AGE && (latest.groups & groups) == groups
+        && latest.localizerResets == localizer.getResets();
+    SensorSnapshot snapshot = latest;
+    if (fresh) reuses++;
+    mutex.give();
+
+    return fresh ? snapshot : sample(drive, localizer, groups);
+}
+
+SensorSnapshot SensorSampler::sample(Drive& drive, Localizer& localizer, uint8_t groups) {
+
+    SensorSnapshot snapshot;
+    snapshot.time = pros::micros();
+    snapshot.groups = groups;
+    snapshot.localizerResets = localizer.getResets();
+    if (groups & SENSE_DRIVE) drive.sample(snapshot);
+    if (groups & SENSE_LOCALIZER) localizer.sample(snapshot);
+
+    mutex.take();
+    latest = snapshot;
+    hasSample = true;
+    samples++;
+    mutex.give();
+
+    return snapshot;
+}
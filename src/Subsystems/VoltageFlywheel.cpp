@@ -6,6 +6,6 @@ VoltageFlywheel::VoltageFlywheel(std::initializer_list<int8_t> flywheelMotors, s
     gain(gainConstant)
 {}
 
-void VoltageFlywheel::maintainVelocityTask() {
+void VoltageFlywheel::maintainVelocity() {
 
 }
\ No newline at end of file
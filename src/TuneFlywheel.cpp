@@ -1,6 +1,7 @@
 #include "main.h"
 #include "TuneFlywheel.h"
 #include "Algorithms/FixedRingQueue.h"
+#include "misc/Display.h"
 
 int volts = 12;
 
@@ -8,6 +9,8 @@ void tuneFlywheel(Robot& robot, ControllerSM& controller) {
 
     robot.flywheel->setRawVoltage(volts);
     pros::lcd::initialize();
+    display.start();
+    display.setGraphRange(0, 3600);
 
     RingQueue q(50);
 
@@ -17,10 +20,11 @@ void tuneFlywheel(Robot& robot, ControllerSM& controller) {
 
         q.push(speed);
 
-        pros::lcd::clear();
-        pros::lcd::print(0, "Input Voltage (volts): %d", volts);
-        pros::lcd::print(1, "Raw flywheel speed (rpm): %f", speed);
-        pros::lcd::print(2, "Raw flywheel speed (rpm): %f", q.getAverage());
+        display.clear();
+        display.print(0, "Input Voltage (volts): %d", volts);
+        display.print(1, "Raw flywheel speed (rpm): %f", speed);
+        display.print(2, "Raw flywheel speed (rpm): %f", q.getAverage());
+        display.plot(speed);
 
         if (controller.pressed(DIGITAL_UP)) {
             if (volts < 12) volts++;
@@ -1,6 +1,9 @@
 #include "main.h"
 
 #include "Subsystems/RobotBuilder.h"
+#include "misc/Display.h"
+#include "misc/Telemetry.h"
+#include "PathFollowing/PathCache.h"
 #include "Programs/Driver.h"
 #include "Programs/CompetitionDriver.h"
 #include "Programs/FlywheelDriver.h"
@@ -54,6 +57,9 @@ void initialize() {
     pros::lcd::initialize();
     pros::lcd::register_btn1_cb (ready);
     pros::lcd::register_btn0_cb(lowerCata);
+    display.start(); // everything else posts to the screen through this
+    telemetry.start(); // a new log on the SD card each boot, nothing without a card
+    pathCache.start(); // routes are made ready in the background, so autonomous never waits on generation
 
     
     if (robot.shooterFlap) robot.shooterFlap->set_value(true); // start flap up
@@ -64,7 +70,7 @@ void initialize() {
     #ifndef TUNE_FLYWHEEL
     while (!centerButtonReady) {
 
-        pros::lcd::print(3, "Heading (deg): %f", robot.localizer->getHeading() * 180 / 3.1415);
+        display.print(3, "Heading (deg): %f", robot.localizer->getHeading() * 180 / 3.1415);
         
         pros::delay(10);
     }
@@ -77,24 +83,18 @@ void initialize() {
 void disabled() {}
 
 
-void competition_initialize() {}
+void competition_initialize() {
+    pathCache.start(); // no-op if initialize() already started it
+}
 
 
 void autonomous() {  
 
     if (robot.shooterFlap) robot.shooterFlap->set_value(false); // flap down  
 
-    if (true && robot.flywheel) {
-        pros::Task taskFlywheel([&] {
-            robot.flywheel->maintainVelocityTask();
-        });
-    }
-
-    if (true && robot.localizer) {
-        pros::Task taskOdometry([&] {
-            robot.localizer->updatePositionTask();
-        });
-    }
+    // Localization runs before flywheel control in each executive tick, and both before the motion loops below
+    scheduleLocalizer(robot);
+    scheduleFlywheel(robot);
 
     try {
 
@@ -114,8 +114,9 @@ void autonomous() {
         #endif
 
     } catch (std::runtime_error &e) {
-        pros::lcd::clear();
-        pros::lcd::print(0, "IMU disconnect, force shutdown.");
+        // Both IMUs disconnected, or a localization or flywheel callback stopped (see checkSubsystems)
+        display.clear();
+        display.print(0, "%s Force shutdown.", e.what());
         robot.drive->stop();
         robot.intake->brake();
     }
@@ -0,0 +1,87 @@
+#include "misc/CachedMotor.h"
+#include "pros/rtos.hpp"
+
+bool MotorOutputCache::shouldWrite(int32_t newVoltage, int motorCount) {
+
+    uint32_t now = pros::millis();
+    if (valid && newVoltage == voltage && now - time < REFRESH_TIME) {
+        stats.suppressed += motorCount;
+        return false;
+    }
+
+    valid = true;
+    voltage = newVoltage;
+    time = now;
+    stats.written += motorCount;
+    return true;
+}
+
+std::int32_t CachedMotorGroup::move_voltage(const std::int32_t voltage) {
+    if (!cache.shouldWrite(voltage, size())) return 1;
+    return pros::MotorGroup::move_voltage(voltage);
+}
+
+std::int32_t CachedMotorGroup::operator=(std::int32_t voltage) {
+    cache.invalidate();
+    return pros::MotorGroup::operator=(voltage);
+}
+
+std::int32_t CachedMotorGroup::move(std::int32_t voltage) {
+    cache.invalidate();
+    return pros::MotorGroup::move(voltage);
+}
+
+std::int32_t CachedMotorGroup::move_velocity(const std::int32_t velocity) {
+    cache.invalidate();
+    return pros::MotorGroup::move_velocity(velocity);
+}
+
+std::int32_t CachedMotorGroup::move_absolute(const double position, const std::int32_t velocity) {
+    cache.invalidate();
+    return pros::MotorGroup::move_absolute(position, velocity);
+}
+
+std::int32_t CachedMotorGroup::move_relative(const double position, const std::int32_t velocity) {
+    cache.invalidate();
+    return pros::MotorGroup::move_relative(position, velocity);
+}
+
+std::int32_t CachedMotorGroup::brake(void) {
+    if (!cache.shouldWrite(MotorOutputCache::BRAKE, size())) return 1;
+    return pros::MotorGroup::brake();
+}
+
+std::int32_t CachedMotor::move_voltage(const std::int32_t voltage) const {
+    if (!cache.shouldWrite(voltage, 1)) return 1;
+    return pros::Motor::move_voltage(voltage);
+}
+
+std::int32_t CachedMotor::operator=(std::int32_t voltage) const {
+    cache.invalidate();
+    return pros::Motor::operator=(voltage);
+}
+
+std::int32_t CachedMotor::move(std::int32_t voltage) const {
+    cache.invalidate();
+    return pros::Motor::move(voltage);
+}
+
+std::int32_t CachedMotor::move_velocity(const std::int32_t velocity) const {
+    cache.invalidate();
+    return pros::Motor::move_velocity(velocity);
+}
+
+std::int32_t CachedMotor::move_absolute(const double position, const std::int32_t velocity) const {
+    cache.invalidate();
+    return pros::Motor::move_absolute(position, velocity);
+}
+
+std::int32_t CachedMotor::move_relative(const double position, const std::int32_t velocity) const {
+    cache.invalidate();
+    return pros::Motor::move_relative(position, velocity);
+}
+
+std::int32_t CachedMotor::brake(void) const {
+    if (!cache.shouldWrite(MotorOutputCache::BRAKE, 1)) return 1;
+    return pros::Motor::brake();
+}
@@ -0,0 +1,199 @@
+#include "misc/Display.h"
+#include "misc/PeriodicLoop.h"
+#include "pros/llemu.hpp"
+#include "pros/screen.hpp"
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+Display display;
+
+void Display::print(int line, const char* format, ...) {
+
+    char text[LINE_LENGTH];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+
+    post(line, text);
+}
+
+void Display::clearLine(int line) {
+    post(line, "");
+}
+
+void Display::clear() {
+    for (int line = 0; line < LINES; line++) post(line, "");
+}
+
+void Display::setAlert(bool on) {
+    alert = on;
+}
+
+void Display::post(int line, const char* text) {
+
+    if (line < 0 || line >= LINES) return;
+
+    Line& l = lines[line];
+    if (l.claimed.exchange(true, std::memory_order_acquire)) {
+        dropped++;
+        return;
+    }
+
+    l.version.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    strncpy(l.text, text, LINE_LENGTH - 1);
+    l.text[LINE_LENGTH - 1] = '\0';
+    l.version.fetch_add(1, std::memory_order_release);
+    l.claimed.store(false, std::memory_order_release);
+
+    posts++;
+}
+
+bool Display::beginGraphWrite() {
+
+    if (graphClaimed.exchange(true, std::memory_order_acquire)) {
+        dropped++;
+        return false;
+    }
+
+    graphVersion.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    return true;
+}
+
+void Display::endGraphWrite() {
+    graphVersion.fetch_add(1, std::memory_order_release);
+    graphClaimed.store(false, std::memory_order_release);
+    posts++;
+}
+
+void Display::plot(float value) {
+
+    if (!beginGraphWrite()) return;
+
+    graph.points[graph.next] = value;
+    graph.next = (graph.next + 1) % GRAPH_POINTS;
+    if (graph.count < GRAPH_POINTS) graph.count++;
+
+    endGraphWrite();
+}
+
+void Display::setGraphRange(float low, float high) {
+
+    if (!beginGraphWrite()) return;
+
+    graph.low = low;
+    graph.high = high;
+
+    endGraphWrite();
+}
+
+void Display::clearGraph() {
+
+    if (!beginGraphWrite()) return;
+
+    graph.count = 0;
+    graph.next = 0;
+
+    endGraphWrite();
+}
+
+void Display::start(uint32_t taskPriority) {
+
+    if (task) return;
+
+    task.reset(new pros::Task([this] {
+        PeriodicLoop loop(FRAME_PERIOD);
+        while (true) {
+            drawFrame();
+            loop.wait();
+        }
+    }, taskPriority, TASK_STACK_DEPTH_DEFAULT, "Display"));
+}
+
+void Display::drawFrame() {
+
+    if (!pros::lcd::is_initialized()) return;
+
+    bool alertNow = alert;
+    if (alertNow != shownAlert) {
+        if (alertNow) {
+            pros::screen::set_pen(0x00FF0000);
+            pros::screen::fill_rect(0, 0, 200, 200);
+        } else {
+            // Erasing the box also erases the text, so every line needs drawing again
+            pros::screen::erase();
+            for (int i = 0; i < LINES; i++) {
+                shown[i][0] = '\0';
+                shownVersion[i]--;
+            }
+            shownGraphVersion--;
+        }
+        shownAlert = alertNow;
+    }
+
+    for (int i = 0; i < LINES; i++) {
+
+        Line& l = lines[i];
+        uint32_t before = l.version.load(std::memory_order_acquire);
+        if (before == shownVersion[i] || (before & 1)) continue; // unchanged, or being written
+
+        char text[LINE_LENGTH];
+        memcpy(text, l.text, LINE_LENGTH);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (l.version.load(std::memory_order_relaxed) != before) continue; // written while copying, retry next frame
+
+        shownVersion[i] = before;
+        if (strcmp(text, shown[i]) == 0) continue;
+
+        pros::lcd::set_text(i, text);
+        memcpy(shown[i], text, LINE_LENGTH);
+        linesDrawn++;
+    }
+
+    drawGraph();
+
+    frames++;
+}
+
+void Display::drawGraph() {
+
+    uint32_t before = graphVersion.load(std::memory_order_acquire);
+    if (before == shownGraphVersion || (before & 1)) return;
+
+    GraphState copy;
+    memcpy(&copy, &graph, sizeof(GraphState));
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (graphVersion.load(std::memory_order_relaxed) != before) return; // written while copying, retry next frame
+
+    shownGraphVersion = before;
+    shownGraph = copy;
+
+    pros::screen::erase_rect(GRAPH_LEFT, GRAPH_TOP, GRAPH_RIGHT, GRAPH_BOTTOM);
+    if (shownGraph.count == 0) return; // cleared
+    pros::screen::set_pen(0x00FFFFFF);
+    pros::screen::draw_rect(GRAPH_LEFT, GRAPH_TOP, GRAPH_RIGHT, GRAPH_BOTTOM);
+
+    float range = shownGraph.high - shownGraph.low;
+    if (range <= 0) range = 1;
+    float xStep = (float) (GRAPH_RIGHT - GRAPH_LEFT) / (GRAPH_POINTS - 1);
+    int oldest = shownGraph.count < GRAPH_POINTS ? 0 : shownGraph.next;
+
+    int16_t lastX = 0, lastY = 0;
+    for (int i = 0; i < shownGraph.count; i++) {
+
+        float value = shownGraph.points[(oldest + i) % GRAPH_POINTS];
+        float fraction = fmin(fmax((value - shownGraph.low) / range, 0), 1);
+        int16_t x = GRAPH_LEFT + (int16_t) (i * xStep);
+        int16_t y = GRAPH_BOTTOM - (int16_t) (fraction * (GRAPH_BOTTOM - GRAPH_TOP));
+
+        if (i > 0) pros::screen::draw_line(lastX, lastY, x, y);
+        lastX = x;
+        lastY = y;
+    }
+
+    graphsDrawn++;
+}
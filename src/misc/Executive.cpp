@@ -0,0 +1,170 @@
+#include "misc/Executive.h"
+#include "misc/Display.h"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <stdio.h>
+#include <string.h>
+
+bool Executive::add(const char* name, uint32_t periodMs, int priority, std::function<void()> callback, uint32_t phaseMs) {
+
+    mutex.take();
+
+    for (std::unique_ptr<Callback>& c : callbacks) {
+        if (!strcmp(c->stats.name, name)) {
+            mutex.give();
+            return false;
+        }
+    }
+
+    Callback* c = new Callback();
+    c->stats.name = name;
+    c->stats.period = std::max<uint32_t>(periodMs, 1);
+    c->stats.priority = priority;
+    c->phase = phaseMs % c->stats.period;
+    c->function = callback;
+
+    // Keep run order sorted by priority, after existing callbacks of the same priority
+    auto position = std::upper_bound(callbacks.begin(), callbacks.end(), priority,
+        [](int p, const std::unique_ptr<Callback>& other) { return p < other->stats.priority; });
+    callbacks.insert(position, std::unique_ptr<Callback>(c));
+
+    // A new period or phase can shorten the tick. Round the clock down so it stays on the new tick grid
+    tickPeriod = std::gcd(tickPeriod, std::gcd(c->stats.period, c->phase));
+    tickTime -= tickTime % tickPeriod;
+
+    mutex.give();
+    return true;
+}
+
+void Executive::start(uint32_t taskPriority, const char* taskName) {
+    if (task) return;
+    stopping = false;
+    finished = false;
+    task.reset(new pros::Task([this] { run(); }, taskPriority, TASK_STACK_DEPTH_DEFAULT, taskName));
+}
+
+void Executive::stop() {
+    if (!task) return;
+    // The task only stops between ticks, never while it holds the mutex or is in a callback
+    stopping = true;
+    while (!finished) pros::delay(1);
+    task.reset();
+}
+
+int Executive::getCallbackCount() {
+    mutex.take();
+    int count = callbacks.size();
+    mutex.give();
+    return count;
+}
+
+CallbackStats Executive::getStats(int index) {
+    mutex.take();
+    CallbackStats stats = callbacks[index]->stats;
+    mutex.give();
+    return stats;
+}
+
+bool Executive::getStopped(CallbackStats& stats, int maxPriority) {
+
+    if (stoppedCount == 0) return false;
+
+    bool found = false;
+    mutex.take();
+    for (std::unique_ptr<Callback>& c : callbacks) {
+        if (c->stats.stopped && c->stats.priority <= maxPriority) {
+            stats = c->stats;
+            found = true;
+            break;
+        }
+    }
+    mutex.give();
+    return found;
+}
+
+uint32_t Executive::getTickPeriod() {
+    mutex.take();
+    uint32_t period = tickPeriod;
+    mutex.give();
+    return period;
+}
+
+void Executive::run() {
+
+    // Wait for the first callback if there is none yet
+    uint32_t period = 0;
+    while (!stopping && !(period = getTickPeriod())) pros::delay(10);
+    if (stopping) {
+        finished = true;
+        return;
+    }
+
+    mutex.take();
+    tickTime = 0;
+    mutex.give();
+
+    PeriodicLoop loop(period, &loopTiming);
+    while (!stopping) {
+
+        tick();
+
+        mutex.take();
+        period = tickPeriod;
+        mutex.give();
+
+        if (period != loop.getPeriod()) loop = PeriodicLoop(period, &loopTiming);
+        uint32_t missed = loopTiming.missedPeriods;
+        loop.wait();
+
+        // After an overrun, skip the ticks that were missed instead of running them late
+        mutex.take();
+        tickTime += period * (1 + loopTiming.missedPeriods - missed);
+        mutex.give();
+    }
+    finished = true;
+}
+
+void Executive::tick() {
+
+    // Pick this tick's callbacks under the lock, then run them without it so a callback can call add()
+    mutex.take();
+    due.clear();
+    for (std::unique_ptr<Callback>& c : callbacks) {
+        if (!c->stats.stopped && tickTime % c->stats.period == c->phase) due.push_back(c.get());
+    }
+    mutex.give();
+
+    for (Callback* c : due) {
+
+        const char* reason = nullptr;
+        char what[sizeof(c->stats.stopReason)];
+        uint64_t start = pros::micros();
+        try {
+            c->function();
+        } catch (std::exception& e) {
+            snprintf(what, sizeof(what), "%s", e.what());
+            reason = what;
+        } catch (...) {
+            reason = "unknown exception";
+        }
+        uint32_t time = pros::micros() - start;
+
+        if (reason) {
+            // Whatever depends on the callback finds out through getStopped()
+            display.print(6, "%s stopped: %s", c->stats.name, reason);
+        }
+
+        mutex.take();
+        if (reason) {
+            c->stats.stopped = true;
+            snprintf(c->stats.stopReason, sizeof(c->stats.stopReason), "%s", reason);
+            stoppedCount++;
+        }
+        c->stats.runs++;
+        c->stats.totalTime += time;
+        c->stats.lastTime = time;
+        if (time > c->stats.maxTime) c->stats.maxTime = time;
+        mutex.give();
+    }
+}
@@ -0,0 +1,41 @@
+#include "misc/PeriodicLoop.h"
+#include "pros/rtos.hpp"
+
+PeriodicLoop::PeriodicLoop(uint32_t periodMs, LoopTiming* sharedTiming):
+    period(periodMs),
+    iterationStart(pros::micros()),
+    timing(sharedTiming ? sharedTiming : &ownTiming)
+{
+    // Round up to the grid, so the first deadline is at least a whole period away
+    uint32_t now = pros::millis();
+    previousWake = now + (period - now % period) % period;
+}
+
+void PeriodicLoop::wait() {
+
+    uint64_t now = pros::micros();
+    uint32_t bodyTime = now - iterationStart;
+    timing->lastBodyTime = bodyTime;
+    if (bodyTime > timing->maxBodyTime) timing->maxBodyTime = bodyTime;
+
+    uint64_t deadline = (uint64_t) (previousWake + period) * 1000;
+    if (now > deadline) {
+        // Overran: run the late iteration now. Once a whole period or more late, resync to the last period
+        // boundary so the loop stays on the grid other loops and the Executive share, skipping the boundaries
+        // between the deadline and it
+        timing->overruns++;
+        previousWake += period;
+        uint32_t lastBoundary = now / 1000 - (now / 1000) % period;
+        if (lastBoundary > previousWake) {
+            timing->missedPeriods += (lastBoundary - previousWake) / period;
+            previousWake = lastBoundary;
+        }
+    }
+    else pros::Task::delay_until(&previousWake, period);
+    iterationStart = pros::micros();
+
+    uint32_t jitter = iterationStart > deadline ? iterationStart - deadline : 0;
+    timing->totalJitter += jitter;
+    if (jitter > timing->maxJitter) timing->maxJitter = jitter;
+    timing->iterations++;
+}
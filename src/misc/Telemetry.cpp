@@ -0,0 +1,133 @@
+#include "misc/Telemetry.h"
+#include "misc/PeriodicLoop.h"
+#include "pros/misc.hpp"
+
+Telemetry telemetry;
+
+void Telemetry::log(TelemetryChannel channel, std::initializer_list<float> values) {
+    log(channel, pros::micros(), values);
+}
+
+void Telemetry::log(TelemetryChannel channel, uint32_t time, std::initializer_list<float> values) {
+
+    if (!running || channel >= TELEMETRY_CHANNELS) return;
+
+    TelemetryRecord record;
+    record.time = time;
+    record.sequence = sequence.fetch_add(1, std::memory_order_relaxed);
+    record.channel = channel;
+    record.count = 0;
+    for (float value : values) {
+        if (record.count == TelemetryRecord::MAX_VALUES) break;
+        record.values[record.count++] = value;
+    }
+
+    rings[channel].push(record);
+}
+
+bool Telemetry::open(FILE* sinkFile) {
+
+    if (sink || !sinkFile) return false;
+
+    sink = sinkFile;
+    int headerSize = encoder.writeHeader(buffer, sizeof(buffer));
+    fwrite(buffer, 1, headerSize, sink);
+    bytesWritten += headerSize;
+    running = true;
+    return true;
+}
+
+void Telemetry::start(FILE* sinkFile, uint32_t taskPriority) {
+    if (!open(sinkFile)) return;
+    task.reset(new pros::Task([this] { drainTask(); }, taskPriority, TASK_STACK_DEPTH_DEFAULT, "Telemetry"));
+}
+
+bool Telemetry::start(const char* sdPrefix, uint32_t taskPriority) {
+
+    if (sink || !pros::usd::is_installed()) return false;
+
+    char path[64];
+    unsigned number = 0;
+    snprintf(path, sizeof(path), "%snext.txt", sdPrefix);
+    FILE* counter = fopen(path, "r");
+    if (counter) {
+        if (fscanf(counter, "%u", &number) != 1) number = 0;
+        fclose(counter);
+    }
+
+    // Skip over logs that exist anyway, e.g. if the counter file was deleted
+    for (;; number++) {
+        snprintf(path, sizeof(path), "%s%04u.bin", sdPrefix, number);
+        FILE* existing = fopen(path, "rb");
+        if (!existing) break;
+        fclose(existing);
+    }
+    FILE* file = fopen(path, "wb");
+    if (!file) return false;
+
+    snprintf(path, sizeof(path), "%snext.txt", sdPrefix);
+    if ((counter = fopen(path, "w"))) {
+        fprintf(counter, "%u\n", number + 1);
+        fclose(counter);
+    }
+
+    start(file, taskPriority);
+    return true;
+}
+
+void Telemetry::drain() {
+
+    if (!sink) return;
+
+    // Only what is queued now, so a fast producer can't keep the drain going forever
+    uint32_t remaining[TELEMETRY_CHANNELS];
+    for (int c = 0; c < TELEMETRY_CHANNELS; c++) remaining[c] = rings[c].size();
+
+    int used = 0;
+    bool wrote = false;
+    while (true) {
+
+        // In the order the records were logged, so events on different channels (e.g. a localizer reset and the
+        // sensor readings around it) stay in order in the log, even within the same microsecond
+        int next = -1;
+        uint32_t nextSequence = 0;
+        for (int c = 0; c < TELEMETRY_CHANNELS; c++) {
+            const TelemetryRecord* front = remaining[c] ? rings[c].peek() : nullptr;
+            if (front && (next < 0 || (int32_t) (front->sequence - nextSequence) < 0)) {
+                next = c;
+                nextSequence = front->sequence;
+            }
+        }
+        if (next < 0) break;
+
+        TelemetryRecord record;
+        rings[next].pop(record);
+        remaining[next]--;
+
+        if (used + TELEMETRY_MAX_RECORD_BYTES > (int) sizeof(buffer)) {
+            fwrite(buffer, 1, used, sink);
+            bytesWritten += used;
+            used = 0;
+        }
+        used += encoder.encode(record, buffer + used);
+        written++;
+        wrote = true;
+    }
+    fwrite(buffer, 1, used, sink);
+    bytesWritten += used;
+    if (wrote) fflush(sink);
+}
+
+void Telemetry::drainTask() {
+    PeriodicLoop loop(DRAIN_PERIOD);
+    while (true) {
+        drain();
+        loop.wait();
+    }
+}
+
+uint32_t Telemetry::getDropped() {
+    uint32_t dropped = 0;
+    for (auto& ring : rings) dropped += ring.getDropped();
+    return dropped;
+}
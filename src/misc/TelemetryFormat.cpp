@@ -0,0 +1,173 @@
+#include "misc/TelemetryFormat.h"
+#include <math.h>
+#include <string.h>
+
+const TelemetrySchema TELEMETRY_SCHEMAS[TELEMETRY_CHANNELS] = {
+    {"motion", 4, {"distanceError", "headingError", "left", "right"}, {1000, 10000, 10000, 10000}},
+    {"odometry", 6, {"x", "y", "heading", "imuHeading", "gpsX", "gpsY"}, {1000, 1000, 10000, 10000, 1000, 1000}},
+    {"flywheel", 3, {"targetRPM", "rpm", "volts"}, {10, 10, 1000}},
+    {"shooter", 6, {"state", "error", "targetRPM", "rpm", "motor0", "motor1"}, {1, 10, 10, 10, 100, 100}},
+    {"sensors", 12, {"left", "right", "imuHeading", "gpsX", "gpsY", "gpsHeading", "gpsError", "imuHeadingA",
+        "imuHeadingB", "imuValidA", "imuValidB", "sampleAge"},
+        {1000, 1000, 10000, 1000, 1000, 10000, 10000, 10000, 10000, 1, 1, 1}},
+    {"odometryStart", 3, {"x", "y", "positionKnown"}, {1000, 1000, 1}},
+    {"odometrySetPosition", 2, {"x", "y"}, {1000, 1000}},
+    {"odometrySetHeading", 6, {"heading", "imuHeading", "imuHeadingA", "imuHeadingB", "imuValidA", "imuValidB"},
+        {10000, 10000, 10000, 10000, 1, 1}},
+};
+
+int putVarint(uint8_t* out, uint32_t value) {
+    int n = 0;
+    while (value >= 0x80) {
+        out[n++] = (value & 0x7F) | 0x80;
+        value >>= 7;
+    }
+    out[n++] = value;
+    return n;
+}
+
+int getVarint(const uint8_t* in, int available, uint32_t& value) {
+    value = 0;
+    for (int n = 0; n < available && n < 5; n++) {
+        value |= (uint32_t) (in[n] & 0x7F) << (7 * n);
+        if (!(in[n] & 0x80)) return n + 1;
+    }
+    return 0;
+}
+
+// Fixed point value, saturated to 32 bits
+static int32_t quantize(float value, uint32_t scale) {
+    double scaled = round((double) value * scale);
+    if (scaled > INT32_MAX) return INT32_MAX;
+    if (scaled < INT32_MIN) return INT32_MIN;
+    if (scaled != scaled) return 0; // NaN
+    return (int32_t) scaled;
+}
+
+static int putString(uint8_t* out, const char* text) {
+    int length = strlen(text) + 1;
+    memcpy(out, text, length);
+    return length;
+}
+
+int TelemetryEncoder::writeHeader(uint8_t* out, int capacity) {
+
+    // Generous bound: names and fields are short
+    int needed = 5;
+    for (const TelemetrySchema& schema : TELEMETRY_SCHEMAS) {
+        needed += 2 + strlen(schema.name) + 1;
+        for (int i = 0; i < schema.count; i++) needed += strlen(schema.fields[i]) + 1 + 5;
+    }
+    if (needed > capacity) return 0;
+
+    int n = 0;
+    out[n++] = 'T';
+    out[n++] = 'L';
+    out[n++] = 'M';
+    out[n++] = TELEMETRY_VERSION;
+    out[n++] = TELEMETRY_CHANNELS;
+    for (int id = 0; id < TELEMETRY_CHANNELS; id++) {
+        const TelemetrySchema& schema = TELEMETRY_SCHEMAS[id];
+        out[n++] = id;
+        out[n++] = schema.count;
+        n += putString(out + n, schema.name);
+        for (int i = 0; i < schema.count; i++) {
+            n += putString(out + n, schema.fields[i]);
+            n += putVarint(out + n, schema.scales[i]);
+        }
+    }
+    return n;
+}
+
+int TelemetryEncoder::encode(const TelemetryRecord& record, uint8_t* out) {
+
+    if (record.channel >= TELEMETRY_CHANNELS) return 0;
+    const TelemetrySchema& schema = TELEMETRY_SCHEMAS[record.channel];
+
+    int n = 0;
+    out[n++] = record.channel;
+    n += putVarint(out + n, record.time - lastTime[record.channel]);
+    lastTime[record.channel] = record.time;
+
+    int32_t* last = lastValues[record.channel];
+    for (int i = 0; i < schema.count; i++) {
+        int32_t value = i < record.count ? quantize(record.values[i], schema.scales[i]) : 0;
+        n += putVarint(out + n, zigzag((int32_t) ((uint32_t) value - (uint32_t) last[i])));
+        last[i] = value;
+    }
+    return n;
+}
+
+// Copies a \0 terminated string, truncating it to fit. Returns bytes read, 0 if the terminator is missing
+static int getString(const uint8_t* in, int available, char* out, int capacity) {
+    const void* end = memchr(in, '\0', available);
+    if (!end) return 0;
+    int length = (const uint8_t*) end - in;
+    int copied = length < capacity - 1 ? length : capacity - 1;
+    memcpy(out, in, copied);
+    out[copied] = '\0';
+    return length + 1;
+}
+
+int TelemetryDecoder::readHeader(const uint8_t* in, int available) {
+
+    if (available < 5) return 0;
+    if (in[0] != 'T' || in[1] != 'L' || in[2] != 'M' || in[3] != TELEMETRY_VERSION) return -1;
+
+    int channelCount = in[4];
+    int n = 5;
+    for (int c = 0; c < channelCount; c++) {
+        if (available - n < 2) return 0;
+        uint8_t id = in[n++];
+        uint8_t count = in[n++];
+        if (id >= TELEMETRY_MAX_CHANNELS || count > TelemetryRecord::MAX_VALUES) return -1;
+
+        Channel& channel = channels[id];
+        channel.count = count;
+        int read = getString(in + n, available - n, channel.name, sizeof(channel.name));
+        if (!read) return 0;
+        n += read;
+        for (int i = 0; i < count; i++) {
+            read = getString(in + n, available - n, channel.fields[i], sizeof(channel.fields[i]));
+            if (!read) return 0;
+            n += read;
+            read = getVarint(in + n, available - n, channel.scales[i]);
+            if (!read) return 0;
+            n += read;
+            if (channel.scales[i] == 0) return -1;
+        }
+        channel.defined = true;
+    }
+    return n;
+}
+
+int TelemetryDecoder::decode(const uint8_t* in, int available, uint8_t& channelId, uint32_t& time, double* values) {
+
+    if (available < 1) return 0;
+    channelId = in[0];
+    if (channelId >= TELEMETRY_MAX_CHANNELS || !channels[channelId].defined) return -1;
+    const Channel& channel = channels[channelId];
+
+    int n = 1;
+    uint32_t delta;
+    int read = getVarint(in + n, available - n, delta);
+    if (!read) return 0;
+    n += read;
+
+    int32_t decoded[TelemetryRecord::MAX_VALUES];
+    for (int i = 0; i < channel.count; i++) {
+        uint32_t encoded;
+        read = getVarint(in + n, available - n, encoded);
+        if (!read) return 0;
+        n += read;
+        decoded[i] = (int32_t) ((uint32_t) lastValues[channelId][i] + (uint32_t) unzigzag(encoded));
+    }
+
+    // Only commit the channel state once the whole record is there
+    time = lastTime[channelId] += delta;
+    for (int i = 0; i < channel.count; i++) {
+        lastValues[channelId][i] = decoded[i];
+        values[i] = (double) decoded[i] / channel.scales[i];
+    }
+    return n;
+}